@@ -0,0 +1,581 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: AVL-balanced insertBSTNode() / removeNodeFromTree() with height tracking,
+		 so sorted input no longer degrades the tree into a list. The Q1 and Q5
+		 traversals run on it unchanged. */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+	int height;		// nodes on the longest path down to a leaf (leaf = 1)
+} BSTNode;   // item/left/right come first, so the traversals need no change
+
+typedef struct _QueueNode {
+	BSTNode *data;
+	struct _QueueNode *nextPtr;
+}QueueNode;
+
+typedef struct _queue
+{
+	QueueNode *head;
+	QueueNode *tail;
+}Queue;
+
+typedef struct _stackNode{
+	BSTNode *data;
+	struct _stackNode *next;
+}StackNode;
+
+typedef struct _stack
+{
+	StackNode *top;
+}Stack;
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value);
+BSTNode* removeNodeFromTree(BSTNode *root, int value);
+BSTNode* searchBSTNode(BSTNode *root, int value);
+int checkAVL(BSTNode *node);
+
+void levelOrderTraversal(BSTNode *node);
+void postOrderIterativeS2(BSTNode *root);
+
+BSTNode* dequeue(QueueNode **head, QueueNode **tail);
+void enqueue(QueueNode **head, QueueNode **tail, BSTNode *node);
+int isEmpty(QueueNode *head);
+void push(Stack *stack, BSTNode *node);
+BSTNode* pop(Stack *s);
+int isEmptyStack(Stack *s);
+void removeAll(BSTNode **node);
+
+void benchmarkAVL(int n);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i;
+	c = 1;
+
+	//Initialize the Binary Search Tree as an empty Binary Search Tree
+	BSTNode *root;
+	root = NULL;
+
+	printf("1: Insert an integer into the AVL tree;\n");
+	printf("2: Remove an integer from the AVL tree;\n");
+	printf("3: Print the level-order traversal of the AVL tree;\n");
+	printf("4: Print the post-order traversal of the AVL tree;\n");
+	printf("5: Check the AVL balance and print the height;\n");
+	printf("6: Run the AVL vs plain BST benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1/2/3/4/5/6/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the AVL tree: ");
+			scanf("%d", &i);
+			insertBSTNode(&root, i);
+			break;
+		case 2:
+			printf("Input an integer that you want to remove from the AVL tree: ");
+			scanf("%d", &i);
+			root = removeNodeFromTree(root, i);
+			break;
+		case 3:
+			printf("The resulting level-order traversal of the AVL tree is: ");
+			levelOrderTraversal(root);
+			printf("\n");
+			break;
+		case 4:
+			printf("The resulting post-order traversal of the AVL tree is: ");
+			postOrderIterativeS2(root);
+			printf("\n");
+			break;
+		case 5:
+			i = checkAVL(root);
+			if (i == -1)
+				printf("The tree is NOT a valid AVL tree\n");
+			else
+				printf("The tree is a valid AVL tree of height %d\n", i - 1);
+			break;
+		case 6:
+			printf("Input the number of keys: ");
+			scanf("%d", &i);
+			benchmarkAVL(i);
+			break;
+		case 0:
+			removeAll(&root);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static int height(BSTNode *node)
+{
+	return node == NULL ? 0 : node->height;
+}
+
+static void updateHeight(BSTNode *node)
+{
+	int lh = height(node->left), rh = height(node->right);
+	node->height = 1 + (lh > rh ? lh : rh);
+}
+
+// y의 왼쪽 자식 x를 위로 올림: ((a x b) y c) -> (a x (b y c))
+static BSTNode* rotateRight(BSTNode *y)
+{
+	BSTNode *x = y->left;
+
+	y->left = x->right;
+	x->right = y;
+	updateHeight(y);
+	updateHeight(x);
+	return x;
+}
+
+static BSTNode* rotateLeft(BSTNode *x)
+{
+	BSTNode *y = x->right;
+
+	x->right = y->left;
+	y->left = x;
+	updateHeight(x);
+	updateHeight(y);
+	return y;
+}
+
+// 높이를 갱신하고 좌우 높이 차가 2가 되면 회전으로 복구 - 새 서브트리 루트를 반환
+// - LL/RR은 한 번, LR/RL은 자식을 먼저 반대로 돌려서 두 번 회전
+static BSTNode* rebalance(BSTNode *node)
+{
+	int balance;
+
+	updateHeight(node);
+	balance = height(node->left) - height(node->right);
+	if (balance > 1) {
+		if (height(node->left->left) < height(node->left->right))
+			node->left = rotateLeft(node->left);
+		return rotateRight(node);
+	}
+	if (balance < -1) {
+		if (height(node->right->right) < height(node->right->left))
+			node->right = rotateRight(node->right);
+		return rotateLeft(node);
+	}
+	return node;
+}
+
+// Same contract as the plain insertBSTNode(): duplicates are ignored.
+// Recursion depth is the tree height, which AVL keeps below 1.44 log2(n).
+void insertBSTNode(BSTNode **node, int value)
+{
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+		if (*node == NULL)
+			exit(0);
+		(*node)->item = value;
+		(*node)->left = NULL;
+		(*node)->right = NULL;
+		(*node)->height = 1;
+		return;
+	}
+
+	if (value < (*node)->item)
+		insertBSTNode(&((*node)->left), value);
+	else if (value > (*node)->item)
+		insertBSTNode(&((*node)->right), value);
+	else
+		return;
+	*node = rebalance(*node);
+}
+
+// Q5의 removeNodeFromTree와 같은 방식 (자식이 둘이면 오른쪽 서브트리 최솟값으로 대체)
+// - 되돌아오는 길의 모든 조상에서 rebalance
+BSTNode* removeNodeFromTree(BSTNode *root, int value)
+{
+	BSTNode *temp, *successor;
+
+	if (root == NULL)
+		return NULL;
+
+	if (value < root->item)
+		root->left = removeNodeFromTree(root->left, value);
+	else if (value > root->item)
+		root->right = removeNodeFromTree(root->right, value);
+	else {
+		if (root->left == NULL || root->right == NULL) {
+			temp = root->left != NULL ? root->left : root->right;
+			free(root);
+			return temp;	// 이미 균형 잡힌 서브트리 (또는 NULL)
+		}
+		successor = root->right;
+		while (successor->left != NULL)
+			successor = successor->left;
+		root->item = successor->item;
+		root->right = removeNodeFromTree(root->right, successor->item);
+	}
+	return rebalance(root);
+}
+
+BSTNode* searchBSTNode(BSTNode *root, int value)
+{
+	while (root != NULL && root->item != value)
+		root = value < root->item ? root->left : root->right;
+	return root;
+}
+
+// 순서, 저장된 높이, 균형 조건을 모두 검사 - 정상이면 높이(노드 수 기준), 아니면 -1
+static int checkRange(BSTNode *node, long long lo, long long hi)
+{
+	int lh, rh;
+
+	if (node == NULL)
+		return 0;
+	if (node->item <= lo || node->item >= hi)
+		return -1;
+	lh = checkRange(node->left, lo, node->item);
+	rh = checkRange(node->right, node->item, hi);
+	if (lh == -1 || rh == -1 || lh - rh > 1 || rh - lh > 1)
+		return -1;
+	if (node->height != 1 + (lh > rh ? lh : rh))
+		return -1;
+	return node->height;
+}
+
+int checkAVL(BSTNode *node)
+{
+	return checkRange(node, -2147483649LL, 2147483648LL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Traversals from Q1 and Q5, unchanged
+
+void levelOrderTraversal(BSTNode* root)
+{
+	if (root == NULL)
+		return;
+	Queue *queue = (Queue*)malloc(sizeof(Queue));
+	queue->head = NULL;
+	queue->tail = NULL;
+	enqueue(&queue->head, &queue->tail, root);
+
+	while (!isEmpty(queue->head)) {
+		BSTNode *node = dequeue(&queue->head, &queue->tail);
+		printf("%d ", node->item);
+		if (node->left)
+			enqueue(&queue->head, &queue->tail, node->left);
+		if (node->right)
+			enqueue(&queue->head, &queue->tail, node->right);
+	}
+	free(queue);
+}
+
+void postOrderIterativeS2(BSTNode *root) {
+    if (root == NULL) return;
+
+    Stack *s1 = (Stack *)malloc(sizeof(Stack));
+    Stack *s2 = (Stack *)malloc(sizeof(Stack));
+    s1->top = NULL;
+    s2->top = NULL;
+
+    push(s1, root);
+    while (!isEmptyStack(s1)) {
+        BSTNode *node = pop(s1);
+        push(s2, node);
+
+        if (node->left)  push(s1, node->left);
+        if (node->right) push(s1, node->right);
+    }
+
+    while (!isEmptyStack(s2)) {
+        BSTNode *node = pop(s2);
+        printf("%d ", node->item);
+    }
+
+    free(s1);
+    free(s2);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// enqueue node
+void enqueue(QueueNode **headPtr, QueueNode **tailPtr, BSTNode *node)
+{
+	// dynamically allocate memory
+	QueueNode *newPtr = malloc(sizeof(QueueNode));
+
+	// if newPtr does not equal NULL
+	if (newPtr != NULL) {
+		newPtr->data = node;
+		newPtr->nextPtr = NULL;
+
+		// if queue is empty, insert at head
+		if (isEmpty(*headPtr)) {
+			*headPtr = newPtr;
+		}
+		else { // insert at tail
+			(*tailPtr)->nextPtr = newPtr;
+		}
+
+		*tailPtr = newPtr;
+	}
+	else {
+		printf("Node not inserted");
+	}
+}
+
+BSTNode* dequeue(QueueNode **headPtr, QueueNode **tailPtr)
+{
+	BSTNode *node = (*headPtr)->data;
+	QueueNode *tempPtr = *headPtr;
+	*headPtr = (*headPtr)->nextPtr;
+
+	if (*headPtr == NULL) {
+		*tailPtr = NULL;
+	}
+
+	free(tempPtr);
+
+	return node;
+}
+
+int isEmpty(QueueNode *head)
+{
+	return head == NULL;
+}
+
+void push(Stack *stack, BSTNode * node)
+{
+	StackNode *temp;
+
+	temp = malloc(sizeof(StackNode));
+
+	if (temp == NULL)
+		return;
+	temp->data = node;
+	temp->next = stack->top;
+	stack->top = temp;
+}
+
+BSTNode * pop(Stack * s)
+{
+	StackNode *t;
+	BSTNode * ptr;
+	ptr = NULL;
+
+	t = s->top;
+	if (t != NULL)
+	{
+		ptr = t->data;
+		s->top = t->next;
+		free(t);
+	}
+
+	return ptr;
+}
+
+int isEmptyStack(Stack *s)
+{
+	if (s->top == NULL)
+		return 1;
+	else
+		return 0;
+}
+
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// The plain BST insert/remove/height, iterative so that a degenerate tree
+// cannot overflow the call stack during the benchmark
+static void plainInsert(BSTNode **node, int value)
+{
+	while (*node != NULL) {
+		if (value < (*node)->item)
+			node = &((*node)->left);
+		else if (value > (*node)->item)
+			node = &((*node)->right);
+		else
+			return;
+	}
+	*node = malloc(sizeof(BSTNode));
+	if (*node == NULL)
+		exit(0);
+	(*node)->item = value;
+	(*node)->left = NULL;
+	(*node)->right = NULL;
+	(*node)->height = 1;
+}
+
+static void plainRemove(BSTNode **link, int value)
+{
+	BSTNode *target, **succLink;
+
+	while (*link != NULL && (*link)->item != value)
+		link = value < (*link)->item ? &((*link)->left) : &((*link)->right);
+	if (*link == NULL)
+		return;
+	target = *link;
+	if (target->left != NULL && target->right != NULL) {
+		succLink = &(target->right);
+		while ((*succLink)->left != NULL)
+			succLink = &((*succLink)->left);
+		target->item = (*succLink)->item;
+		link = succLink;
+		target = *link;
+	}
+	*link = target->left != NULL ? target->left : target->right;
+	free(target);
+}
+
+// 한쪽으로만 뻗은 트리도 있으니 재귀 대신 레벨 단위 BFS로 높이(레벨 수) 계산
+static int plainHeight(BSTNode *root)
+{
+	QueueNode *head = NULL, *tail = NULL;
+	BSTNode *node;
+	int levels = 0, width, next;
+
+	if (root == NULL)
+		return 0;
+	enqueue(&head, &tail, root);
+	width = 1;
+	while (width > 0) {
+		levels++;
+		next = 0;
+		while (width-- > 0) {
+			node = dequeue(&head, &tail);
+			if (node->left) {
+				enqueue(&head, &tail, node->left);
+				next++;
+			}
+			if (node->right) {
+				enqueue(&head, &tail, node->right);
+				next++;
+			}
+		}
+		width = next;
+	}
+	return levels;
+}
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// 정렬/역정렬/무작위 순서로 n개를 넣고, 무작위 순서로 모두 찾고, 넣은 순서대로 모두 삭제
+// - 정렬 입력에서 plain BST는 O(n^2)이므로 n이 크면 건너뜀
+void benchmarkAVL(int n)
+{
+	static const char *orderNames[] = { "sorted", "reverse-sorted", "random" };
+	int *keys, *probes;
+	BSTNode *root;
+	clock_t start;
+	double insertTime, searchTime, removeTime;
+	long long found;
+	int order, plain, i, j, tmp, h;
+
+	if (n <= 0)
+		return;
+	keys = malloc(sizeof(int) * n);
+	probes = malloc(sizeof(int) * n);
+	if (keys == NULL || probes == NULL) {
+		free(keys);
+		free(probes);
+		return;
+	}
+	for (i = 0; i < n; i++)
+		probes[i] = i;
+	for (i = n - 1; i > 0; i--) {
+		j = rand() % (i + 1);
+		tmp = probes[i];
+		probes[i] = probes[j];
+		probes[j] = tmp;
+	}
+
+	for (order = 0; order < 3; order++) {
+		for (i = 0; i < n; i++)
+			keys[i] = order == 0 ? i : order == 1 ? n - 1 - i : probes[i];
+		printf("%s input, n = %d:\n", orderNames[order], n);
+
+		for (plain = 1; plain >= 0; plain--) {
+			if (plain && order != 2 && n > 50000) {
+				printf("  plain BST: skipped (O(n^2) on %s input)\n", orderNames[order]);
+				continue;
+			}
+			root = NULL;
+			start = clock();
+			for (i = 0; i < n; i++) {
+				if (plain)
+					plainInsert(&root, keys[i]);
+				else
+					insertBSTNode(&root, keys[i]);
+			}
+			insertTime = elapsed(start);
+			h = plain ? plainHeight(root) : height(root);
+
+			found = 0;
+			start = clock();
+			for (i = 0; i < n; i++)
+				found += searchBSTNode(root, probes[i]) != NULL;
+			searchTime = elapsed(start);
+
+			start = clock();
+			for (i = 0; i < n; i++) {
+				if (plain)
+					plainRemove(&root, keys[i]);
+				else
+					root = removeNodeFromTree(root, keys[i]);
+			}
+			removeTime = elapsed(start);
+
+			printf("  %s: height %d, insert %.3f s, search %.3f s, remove %.3f s%s\n",
+				plain ? "plain BST" : "AVL tree ", h - 1, insertTime, searchTime, removeTime,
+				found == n && root == NULL ? "" : " (CHECK FAILED)");
+		}
+	}
+	free(keys);
+	free(probes);
+}
@@ -0,0 +1,839 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: B+-tree ordered int set with cache-line sized nodes (insert, delete,
+		 lookup, in-order iteration, level-order dump) and a benchmark against
+		 insertBSTNode. The node size is fixed at compile time:
+		 gcc -O2 -DBTREE_NODE_BYTES=64 BTree_F_BST.c   (64/128/256, default 128) */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef BTREE_NODE_BYTES
+#define BTREE_NODE_BYTES 128
+#endif
+
+// 헤더(count, isLeaf) 8바이트 + 리프는 next 포인터, 내부 노드는 자식 포인터 하나가 더 필요
+#define LEAF_KEYS ((BTREE_NODE_BYTES - 16) / 4)
+#define INNER_KEYS ((BTREE_NODE_BYTES - 16) / 12)
+#define LEAF_MIN (LEAF_KEYS / 2)
+#define INNER_MIN (INNER_KEYS / 2)
+
+_Static_assert(INNER_KEYS >= 3, "BTREE_NODE_BYTES must be at least 64");
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bnode{
+	int count;		// number of keys in this node
+	int isLeaf;
+	union {
+		struct {
+			struct _bnode *next;		// next leaf in key order
+			int keys[LEAF_KEYS];
+		} leaf;
+		struct {
+			int keys[INNER_KEYS];		// keys[i] = smallest key under children[i + 1]
+			struct _bnode *children[INNER_KEYS + 1];
+		} inner;
+	} u;
+} BNode;
+
+typedef struct _btree
+{
+	BNode *root;
+	int height;			// levels, all leaves are at the same depth
+	long long size;		// number of keys
+	long long nodes;
+} BTree;
+
+typedef struct _btreeiterator
+{
+	BNode *leaf;		// NULL once the iteration is finished
+	int pos;
+} BTreeIterator;
+
+typedef struct _QueueNode {
+	BNode *data;
+	struct _QueueNode *nextPtr;
+}QueueNode;
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;	// plain BST from Q1, only used by the benchmark
+
+///////////////////////////////////////////////////////////////////////////////////
+
+int insertBTree(BTree *tree, int value);
+int removeBTree(BTree *tree, int value);
+int searchBTree(BTree *tree, int value);
+void firstBTree(BTree *tree, BTreeIterator *it);
+void seekBTree(BTree *tree, BTreeIterator *it, int lo);
+int nextBTree(BTreeIterator *it, int *value);
+void levelOrderBTree(BTree *tree);
+void inOrderBTree(BTree *tree);
+int checkBTree(BTree *tree);
+void removeAllBTree(BTree *tree);
+
+BNode* dequeue(QueueNode **head, QueueNode **tail);
+void enqueue(QueueNode **head, QueueNode **tail, BNode *node);
+int isEmpty(QueueNode *head);
+
+void benchmarkBTree(int n);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j, value;
+	BTreeIterator it;
+	c = 1;
+
+	//Initialize the B+-tree as an empty set
+	BTree tree = { NULL, 0, 0, 0 };
+
+	printf("1: Insert an integer into the B+-tree;\n");
+	printf("2: Remove an integer from the B+-tree;\n");
+	printf("3: Search for an integer in the B+-tree;\n");
+	printf("4: Print the level-order dump of the B+-tree;\n");
+	printf("5: Print the in-order traversal of the B+-tree;\n");
+	printf("6: Print the keys in a range [lo, hi];\n");
+	printf("7: Check the B+-tree and print its height;\n");
+	printf("8: Run the B+-tree vs plain BST benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-8/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the B+-tree: ");
+			scanf("%d", &i);
+			insertBTree(&tree, i);
+			break;
+		case 2:
+			printf("Input an integer that you want to remove from the B+-tree: ");
+			scanf("%d", &i);
+			removeBTree(&tree, i);
+			break;
+		case 3:
+			printf("Input an integer that you want to search for: ");
+			scanf("%d", &i);
+			if (searchBTree(&tree, i))
+				printf("%d is in the B+-tree\n", i);
+			else
+				printf("%d is not in the B+-tree\n", i);
+			break;
+		case 4:
+			printf("The resulting level-order dump of the B+-tree is: ");
+			levelOrderBTree(&tree);
+			printf("\n");
+			break;
+		case 5:
+			printf("The resulting in-order traversal of the B+-tree is: ");
+			inOrderBTree(&tree);
+			printf("\n");
+			break;
+		case 6:
+			printf("Input the range lo and hi: ");
+			scanf("%d %d", &i, &j);
+			printf("The keys in the range are: ");
+			seekBTree(&tree, &it, i);
+			while (nextBTree(&it, &value) && value <= j)
+				printf("%d ", value);
+			printf("\n");
+			break;
+		case 7:
+			i = checkBTree(&tree);
+			if (i == -1)
+				printf("The tree is NOT a valid B+-tree\n");
+			else
+				printf("The tree is a valid B+-tree with %d levels and %lld keys\n", i, tree.size);
+			break;
+		case 8:
+			printf("Input the number of keys: ");
+			scanf("%d", &i);
+			benchmarkBTree(i);
+			break;
+		case 0:
+			removeAllBTree(&tree);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static BNode* newNode(BTree *tree, int isLeaf)
+{
+	// 노드 하나가 캐시 라인 경계에서 시작하도록 64바이트 정렬
+	BNode *node = aligned_alloc(64, (sizeof(BNode) + 63) / 64 * 64);
+
+	if (node == NULL)
+		exit(0);
+	node->count = 0;
+	node->isLeaf = isLeaf;
+	if (isLeaf)
+		node->u.leaf.next = NULL;
+	tree->nodes++;
+	return node;
+}
+
+// value보다 작은 키의 개수 = value 이상인 첫 위치
+// - 노드 안의 키는 한두 캐시 라인이라 이진 탐색보다 분기 없는 선형 카운트가 빠름
+static int lowerBound(const int *keys, int count, int value)
+{
+	int i, pos = 0;
+
+	for (i = 0; i < count; i++)
+		pos += keys[i] < value;
+	return pos;
+}
+
+// value가 들어 있을 자식 번호 = value 이하인 구분 키의 개수
+static int childIndex(BNode *node, int value)
+{
+	int i, pos = 0;
+
+	for (i = 0; i < node->count; i++)
+		pos += node->u.inner.keys[i] <= value;
+	return pos;
+}
+
+static BNode* findLeaf(BNode *node, int value)
+{
+	while (!node->isLeaf)
+		node = node->u.inner.children[childIndex(node, value)];
+	return node;
+}
+
+static void insertKey(int *keys, int count, int i, int value)
+{
+	memmove(keys + i + 1, keys + i, sizeof(int) * (count - i));
+	keys[i] = value;
+}
+
+// node 아래에 value를 넣음. node가 넘치면 반으로 나눠 새 오른쪽 노드를 반환하고
+// *sep에 오른쪽 노드의 최소 키를 돌려줌 (부모가 구분 키로 사용)
+static BNode* insertRec(BTree *tree, BNode *node, int value, int *sep, int *inserted)
+{
+	int keys[INNER_KEYS + 1];
+	BNode *children[INNER_KEYS + 2];
+	BNode *right, *split;
+	int i, half, key;
+
+	if (node->isLeaf) {
+		i = lowerBound(node->u.leaf.keys, node->count, value);
+		if (i < node->count && node->u.leaf.keys[i] == value)
+			return NULL;
+		*inserted = 1;
+		if (node->count < LEAF_KEYS) {
+			insertKey(node->u.leaf.keys, node->count, i, value);
+			node->count++;
+			return NULL;
+		}
+		// 가득 찬 리프: 삽입 후 왼쪽에 half개, 오른쪽에 나머지가 남도록 먼저 옮기고 삽입
+		right = newNode(tree, 1);
+		half = (LEAF_KEYS + 1) / 2;
+		if (i < half) {
+			right->count = LEAF_KEYS - half + 1;
+			memcpy(right->u.leaf.keys, node->u.leaf.keys + half - 1, sizeof(int) * right->count);
+			node->count = half - 1;
+			insertKey(node->u.leaf.keys, node->count, i, value);
+			node->count++;
+		}
+		else {
+			right->count = LEAF_KEYS - half;
+			memcpy(right->u.leaf.keys, node->u.leaf.keys + half, sizeof(int) * right->count);
+			node->count = half;
+			insertKey(right->u.leaf.keys, right->count, i - half, value);
+			right->count++;
+		}
+		right->u.leaf.next = node->u.leaf.next;
+		node->u.leaf.next = right;
+		*sep = right->u.leaf.keys[0];
+		return right;
+	}
+
+	i = childIndex(node, value);
+	split = insertRec(tree, node->u.inner.children[i], value, &key, inserted);
+	if (split == NULL)
+		return NULL;
+	if (node->count < INNER_KEYS) {
+		insertKey(node->u.inner.keys, node->count, i, key);
+		memmove(node->u.inner.children + i + 2, node->u.inner.children + i + 1,
+			sizeof(BNode*) * (node->count - i));
+		node->u.inner.children[i + 1] = split;
+		node->count++;
+		return NULL;
+	}
+
+	// 가득 찬 내부 노드: 임시 배열에 합친 뒤 가운데 키를 부모로 올림
+	memcpy(keys, node->u.inner.keys, sizeof(int) * INNER_KEYS);
+	memcpy(children, node->u.inner.children, sizeof(BNode*) * (INNER_KEYS + 1));
+	insertKey(keys, INNER_KEYS, i, key);
+	memmove(children + i + 2, children + i + 1, sizeof(BNode*) * (INNER_KEYS - i));
+	children[i + 1] = split;
+
+	half = (INNER_KEYS + 1) / 2;
+	right = newNode(tree, 0);
+	node->count = half;
+	memcpy(node->u.inner.keys, keys, sizeof(int) * half);
+	memcpy(node->u.inner.children, children, sizeof(BNode*) * (half + 1));
+	right->count = INNER_KEYS - half;
+	memcpy(right->u.inner.keys, keys + half + 1, sizeof(int) * right->count);
+	memcpy(right->u.inner.children, children + half + 1, sizeof(BNode*) * (right->count + 1));
+	*sep = keys[half];
+	return right;
+}
+
+// Returns 1 if value was inserted, 0 if it was already in the set
+int insertBTree(BTree *tree, int value)
+{
+	BNode *split, *root;
+	int sep, inserted = 0;
+
+	if (tree->root == NULL) {
+		tree->root = newNode(tree, 1);
+		tree->height = 1;
+	}
+	split = insertRec(tree, tree->root, value, &sep, &inserted);
+	if (split != NULL) {
+		// 루트가 나뉘면 새 루트를 만들어 높이가 1 증가
+		root = newNode(tree, 0);
+		root->count = 1;
+		root->u.inner.keys[0] = sep;
+		root->u.inner.children[0] = tree->root;
+		root->u.inner.children[1] = split;
+		tree->root = root;
+		tree->height++;
+	}
+	tree->size += inserted;
+	return inserted;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static void borrowFromLeft(BNode *parent, int i)
+{
+	BNode *child = parent->u.inner.children[i], *left = parent->u.inner.children[i - 1];
+
+	if (child->isLeaf) {
+		insertKey(child->u.leaf.keys, child->count, 0, left->u.leaf.keys[left->count - 1]);
+		parent->u.inner.keys[i - 1] = child->u.leaf.keys[0];
+	}
+	else {
+		// 부모의 구분 키를 내리고 왼쪽 형제의 마지막 키를 올림
+		insertKey(child->u.inner.keys, child->count, 0, parent->u.inner.keys[i - 1]);
+		memmove(child->u.inner.children + 1, child->u.inner.children, sizeof(BNode*) * (child->count + 1));
+		child->u.inner.children[0] = left->u.inner.children[left->count];
+		parent->u.inner.keys[i - 1] = left->u.inner.keys[left->count - 1];
+	}
+	left->count--;
+	child->count++;
+}
+
+static void borrowFromRight(BNode *parent, int i)
+{
+	BNode *child = parent->u.inner.children[i], *right = parent->u.inner.children[i + 1];
+
+	if (child->isLeaf) {
+		child->u.leaf.keys[child->count] = right->u.leaf.keys[0];
+		memmove(right->u.leaf.keys, right->u.leaf.keys + 1, sizeof(int) * (right->count - 1));
+		parent->u.inner.keys[i] = right->u.leaf.keys[0];
+	}
+	else {
+		child->u.inner.keys[child->count] = parent->u.inner.keys[i];
+		child->u.inner.children[child->count + 1] = right->u.inner.children[0];
+		parent->u.inner.keys[i] = right->u.inner.keys[0];
+		memmove(right->u.inner.keys, right->u.inner.keys + 1, sizeof(int) * (right->count - 1));
+		memmove(right->u.inner.children, right->u.inner.children + 1, sizeof(BNode*) * right->count);
+	}
+	right->count--;
+	child->count++;
+}
+
+// children[j+1]을 children[j]에 합치고 부모에서 구분 키 j를 제거
+static void mergeChildren(BTree *tree, BNode *parent, int j)
+{
+	BNode *left = parent->u.inner.children[j], *right = parent->u.inner.children[j + 1];
+
+	if (left->isLeaf) {
+		memcpy(left->u.leaf.keys + left->count, right->u.leaf.keys, sizeof(int) * right->count);
+		left->count += right->count;
+		left->u.leaf.next = right->u.leaf.next;
+	}
+	else {
+		left->u.inner.keys[left->count] = parent->u.inner.keys[j];
+		memcpy(left->u.inner.keys + left->count + 1, right->u.inner.keys, sizeof(int) * right->count);
+		memcpy(left->u.inner.children + left->count + 1, right->u.inner.children,
+			sizeof(BNode*) * (right->count + 1));
+		left->count += right->count + 1;
+	}
+	free(right);
+	tree->nodes--;
+
+	memmove(parent->u.inner.keys + j, parent->u.inner.keys + j + 1, sizeof(int) * (parent->count - j - 1));
+	memmove(parent->u.inner.children + j + 1, parent->u.inner.children + j + 2,
+		sizeof(BNode*) * (parent->count - j - 1));
+	parent->count--;
+}
+
+// 자식이 최소 개수보다 적어지면 형제에게서 빌리고, 형제도 여유가 없으면 합침
+static int removeRec(BTree *tree, BNode *node, int value)
+{
+	BNode *child;
+	int i, min;
+
+	if (node->isLeaf) {
+		i = lowerBound(node->u.leaf.keys, node->count, value);
+		if (i == node->count || node->u.leaf.keys[i] != value)
+			return 0;
+		memmove(node->u.leaf.keys + i, node->u.leaf.keys + i + 1, sizeof(int) * (node->count - i - 1));
+		node->count--;
+		return 1;
+	}
+
+	i = childIndex(node, value);
+	child = node->u.inner.children[i];
+	if (!removeRec(tree, child, value))
+		return 0;
+	min = child->isLeaf ? LEAF_MIN : INNER_MIN;
+	if (child->count >= min)
+		return 1;
+	if (i > 0 && node->u.inner.children[i - 1]->count > min)
+		borrowFromLeft(node, i);
+	else if (i < node->count && node->u.inner.children[i + 1]->count > min)
+		borrowFromRight(node, i);
+	else if (i > 0)
+		mergeChildren(tree, node, i - 1);
+	else
+		mergeChildren(tree, node, i);
+	return 1;
+}
+
+// Returns 1 if value was removed, 0 if it was not in the set
+int removeBTree(BTree *tree, int value)
+{
+	BNode *old = tree->root;
+	int removed;
+
+	if (old == NULL)
+		return 0;
+	removed = removeRec(tree, old, value);
+	if (!old->isLeaf && old->count == 0) {
+		tree->root = old->u.inner.children[0];
+		tree->height--;
+	}
+	else if (old->isLeaf && old->count == 0) {
+		tree->root = NULL;
+		tree->height = 0;
+	}
+	else {
+		old = NULL;
+	}
+	if (old != NULL) {
+		free(old);
+		tree->nodes--;
+	}
+	tree->size -= removed;
+	return removed;
+}
+
+int searchBTree(BTree *tree, int value)
+{
+	BNode *leaf;
+	int i;
+
+	if (tree->root == NULL)
+		return 0;
+	leaf = findLeaf(tree->root, value);
+	i = lowerBound(leaf->u.leaf.keys, leaf->count, value);
+	return i < leaf->count && leaf->u.leaf.keys[i] == value;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// In-order iteration walks the leaf chain, so it needs no stack at all
+
+void firstBTree(BTree *tree, BTreeIterator *it)
+{
+	BNode *node = tree->root;
+
+	while (node != NULL && !node->isLeaf)
+		node = node->u.inner.children[0];
+	it->leaf = node;
+	it->pos = 0;
+}
+
+// Positions the iterator on the first key >= lo
+void seekBTree(BTree *tree, BTreeIterator *it, int lo)
+{
+	if (tree->root == NULL) {
+		it->leaf = NULL;
+		it->pos = 0;
+		return;
+	}
+	it->leaf = findLeaf(tree->root, lo);
+	it->pos = lowerBound(it->leaf->u.leaf.keys, it->leaf->count, lo);
+	if (it->pos == it->leaf->count) {
+		it->leaf = it->leaf->u.leaf.next;
+		it->pos = 0;
+	}
+}
+
+// Stores the next key in *value and returns 1, or returns 0 at the end
+int nextBTree(BTreeIterator *it, int *value)
+{
+	if (it->leaf == NULL)
+		return 0;
+	*value = it->leaf->u.leaf.keys[it->pos++];
+	if (it->pos == it->leaf->count) {
+		it->leaf = it->leaf->u.leaf.next;
+		it->pos = 0;
+	}
+	return 1;
+}
+
+void inOrderBTree(BTree *tree)
+{
+	BTreeIterator it;
+	int value;
+
+	firstBTree(tree, &it);
+	while (nextBTree(&it, &value))
+		printf("%d ", value);
+}
+
+// levelOrderTraversal()와 같은 BFS - 노드마다 [키 ...], 레벨 사이는 |
+void levelOrderBTree(BTree *tree)
+{
+	QueueNode *head = NULL, *tail = NULL;
+	BNode *node;
+	int width, next, i;
+
+	if (tree->root == NULL)
+		return;
+	enqueue(&head, &tail, tree->root);
+	width = 1;
+	while (width > 0) {
+		next = 0;
+		while (width-- > 0) {
+			node = dequeue(&head, &tail);
+			printf("[");
+			for (i = 0; i < node->count; i++) {
+				if (node->isLeaf)
+					printf(i == 0 ? "%d" : " %d", node->u.leaf.keys[i]);
+				else
+					printf(i == 0 ? "%d" : " %d", node->u.inner.keys[i]);
+			}
+			printf("] ");
+			if (!node->isLeaf) {
+				for (i = 0; i <= node->count; i++)
+					enqueue(&head, &tail, node->u.inner.children[i]);
+				next += node->count + 1;
+			}
+		}
+		if (next > 0)
+			printf("| ");
+		width = next;
+	}
+}
+
+// 키 범위, 최소 채움, 리프 깊이를 검사 - 리프 깊이를 돌려주고 문제가 있으면 -1
+static int checkNode(BNode *node, int isRoot, long long lo, long long hi)
+{
+	int i, depth, d;
+
+	if (node->count > (node->isLeaf ? LEAF_KEYS : INNER_KEYS))
+		return -1;
+	if (!isRoot && node->count < (node->isLeaf ? LEAF_MIN : INNER_MIN))
+		return -1;
+	if (node->isLeaf) {
+		for (i = 0; i < node->count; i++) {
+			if (node->u.leaf.keys[i] < lo || node->u.leaf.keys[i] >= hi)
+				return -1;
+			if (i > 0 && node->u.leaf.keys[i - 1] >= node->u.leaf.keys[i])
+				return -1;
+		}
+		return 1;
+	}
+	if (node->count < 1)
+		return -1;
+	depth = -1;
+	for (i = 0; i <= node->count; i++) {
+		if (i < node->count && (node->u.inner.keys[i] < lo || node->u.inner.keys[i] >= hi ||
+			(i > 0 && node->u.inner.keys[i - 1] >= node->u.inner.keys[i])))
+			return -1;
+		d = checkNode(node->u.inner.children[i], 0,
+			i == 0 ? lo : node->u.inner.keys[i - 1],
+			i == node->count ? hi : node->u.inner.keys[i]);
+		if (d == -1 || (depth != -1 && d != depth))
+			return -1;
+		depth = d;
+	}
+	return depth + 1;
+}
+
+// Number of levels if the tree and its leaf chain are consistent, -1 otherwise
+int checkBTree(BTree *tree)
+{
+	BTreeIterator it;
+	long long count = 0, prev = -2147483649LL;
+	int levels, value;
+
+	if (tree->root == NULL)
+		return tree->size == 0 && tree->height == 0 ? 0 : -1;
+	levels = checkNode(tree->root, 1, -2147483649LL, 2147483648LL);
+	if (levels != tree->height)
+		return -1;
+	firstBTree(tree, &it);
+	while (nextBTree(&it, &value)) {
+		if (value <= prev)
+			return -1;
+		prev = value;
+		count++;
+	}
+	return count == tree->size ? levels : -1;
+}
+
+static void freeNode(BNode *node)
+{
+	int i;
+
+	if (!node->isLeaf)
+		for (i = 0; i <= node->count; i++)
+			freeNode(node->u.inner.children[i]);
+	free(node);
+}
+
+void removeAllBTree(BTree *tree)
+{
+	if (tree->root != NULL)
+		freeNode(tree->root);
+	tree->root = NULL;
+	tree->height = 0;
+	tree->size = 0;
+	tree->nodes = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// enqueue node
+void enqueue(QueueNode **headPtr, QueueNode **tailPtr, BNode *node)
+{
+	// dynamically allocate memory
+	QueueNode *newPtr = malloc(sizeof(QueueNode));
+
+	// if newPtr does not equal NULL
+	if (newPtr != NULL) {
+		newPtr->data = node;
+		newPtr->nextPtr = NULL;
+
+		// if queue is empty, insert at head
+		if (isEmpty(*headPtr)) {
+			*headPtr = newPtr;
+		}
+		else { // insert at tail
+			(*tailPtr)->nextPtr = newPtr;
+		}
+
+		*tailPtr = newPtr;
+	}
+	else {
+		printf("Node not inserted");
+	}
+}
+
+BNode* dequeue(QueueNode **headPtr, QueueNode **tailPtr)
+{
+	BNode *node = (*headPtr)->data;
+	QueueNode *tempPtr = *headPtr;
+	*headPtr = (*headPtr)->nextPtr;
+
+	if (*headPtr == NULL) {
+		*tailPtr = NULL;
+	}
+
+	free(tempPtr);
+
+	return node;
+}
+
+int isEmpty(QueueNode *head)
+{
+	return head == NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Plain BST baseline: insertBSTNode as in Q1, plus search/scan/remove
+
+void insertBSTNode(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertBSTNode(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertBSTNode(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+static BSTNode* searchBSTNode(BSTNode *root, int value)
+{
+	while (root != NULL && root->item != value)
+		root = value < root->item ? root->left : root->right;
+	return root;
+}
+
+static long long sumBST(BSTNode *node)
+{
+	if (node == NULL)
+		return 0;
+	return sumBST(node->left) + node->item + sumBST(node->right);
+}
+
+static void plainRemove(BSTNode **link, int value)
+{
+	BSTNode *target, **succLink;
+
+	while (*link != NULL && (*link)->item != value)
+		link = value < (*link)->item ? &((*link)->left) : &((*link)->right);
+	if (*link == NULL)
+		return;
+	target = *link;
+	if (target->left != NULL && target->right != NULL) {
+		succLink = &(target->right);
+		while ((*succLink)->left != NULL)
+			succLink = &((*succLink)->left);
+		target->item = (*succLink)->item;
+		link = succLink;
+		target = *link;
+	}
+	*link = target->left != NULL ? target->left : target->right;
+	free(target);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// i번째 키: murmur3의 fmix32는 32비트 전단사라서 키가 겹치지 않고 순서도 무작위
+static int keyAt(unsigned i)
+{
+	i ^= i >> 16;
+	i *= 0x85ebca6bu;
+	i ^= i >> 13;
+	i *= 0xc2b2ae35u;
+	i ^= i >> 16;
+	return (int)i;
+}
+
+static unsigned nextRandom(unsigned *state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+static void printRow(const char *name, const char *op, double seconds, int n)
+{
+	printf("  %s %-7s %8.3f s %9.1f ns/op\n", name, op, seconds, seconds * 1e9 / n);
+}
+
+// 무작위 순서로 n개 삽입, 무작위 n번 조회, 전체 순회, 삽입 순서대로 전부 삭제
+// - 키 배열을 만들지 않으므로 10^8개까지는 트리 자체의 메모리만 필요
+//   (plain BST는 노드당 malloc 포함 약 32바이트, 10^8개면 약 3.2 GB)
+void benchmarkBTree(int n)
+{
+	BTree tree = { NULL, 0, 0, 0 };
+	BTreeIterator it;
+	BSTNode *root = NULL;
+	clock_t start;
+	long long found, sumTree, sumPlain;
+	unsigned state;
+	int i, value;
+
+	if (n <= 0)
+		return;
+	printf("n = %d, %d-byte nodes (%d keys per leaf, %d per inner node):\n",
+		n, BTREE_NODE_BYTES, LEAF_KEYS, INNER_KEYS);
+
+	start = clock();
+	for (i = 0; i < n; i++)
+		insertBTree(&tree, keyAt(i));
+	printRow("B+-tree  ", "insert", elapsed(start), n);
+	found = 0;
+	state = 2463534242u;
+	start = clock();
+	for (i = 0; i < n; i++)
+		found += searchBTree(&tree, keyAt(nextRandom(&state) % n));
+	printRow("B+-tree  ", "search", elapsed(start), n);
+	sumTree = 0;
+	start = clock();
+	firstBTree(&tree, &it);
+	while (nextBTree(&it, &value))
+		sumTree += value;
+	printRow("B+-tree  ", "scan", elapsed(start), n);
+	printf("  B+-tree   %d levels, %lld nodes, %.1f bytes/key%s\n", tree.height, tree.nodes,
+		(double)tree.nodes * sizeof(BNode) / n,
+		found == n && checkBTree(&tree) == tree.height ? "" : " (CHECK FAILED)");
+	start = clock();
+	for (i = 0; i < n; i++)
+		removeBTree(&tree, keyAt(i));
+	printRow("B+-tree  ", "remove", elapsed(start), n);
+	if (tree.root != NULL)
+		printf("  B+-tree   not empty after remove (CHECK FAILED)\n");
+
+	start = clock();
+	for (i = 0; i < n; i++)
+		insertBSTNode(&root, keyAt(i));
+	printRow("plain BST", "insert", elapsed(start), n);
+	found = 0;
+	state = 2463534242u;
+	start = clock();
+	for (i = 0; i < n; i++)
+		found += searchBSTNode(root, keyAt(nextRandom(&state) % n)) != NULL;
+	printRow("plain BST", "search", elapsed(start), n);
+	start = clock();
+	sumPlain = sumBST(root);
+	printRow("plain BST", "scan", elapsed(start), n);
+	printf("  plain BST %d bytes/key + malloc header%s\n", (int)sizeof(BSTNode),
+		found == n && sumPlain == sumTree ? "" : " (CHECK FAILED)");
+	start = clock();
+	for (i = 0; i < n; i++)
+		plainRemove(&root, keyAt(i));
+	printRow("plain BST", "remove", elapsed(start), n);
+}
@@ -0,0 +1,638 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: O(n) bulk loading of a perfectly balanced BST from a sorted array or
+		 sorted LinkedList into one contiguous node block, a merge-based bulk
+		 insert for sorted batches, and a benchmark against insertBSTNode */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;
+
+typedef struct _listnode{
+	int item;
+	struct _listnode *next;
+} ListNode;
+
+typedef struct _linkedlist{
+	int size;
+	ListNode *head;
+} LinkedList;
+
+// A bulk-loaded tree owns one malloc block in which nodes[i] holds the i-th
+// smallest key, so an in-order walk reads memory front to back and the whole
+// tree is released with a single free()
+typedef struct _bulktree{
+	BSTNode *root;
+	BSTNode *nodes;
+	int size;
+} BulkTree;
+
+typedef struct _QueueNode {
+	BSTNode *data;
+	struct _QueueNode *nextPtr;
+}QueueNode;
+
+typedef struct _queue
+{
+	QueueNode *head;
+	QueueNode *tail;
+}Queue;
+
+///////////////////////////////////////////////////////////////////////////////////
+
+int buildBSTFromArray(BulkTree *tree, const int *sorted, int n);
+int buildBSTFromList(BulkTree *tree, LinkedList *ll);
+int mergeSortedBatch(BulkTree *tree, const int *batch, int m);
+void removeAllBulk(BulkTree *tree);
+
+void insertBSTNode(BSTNode **node, int value);
+void levelOrderTraversal(BSTNode *root);
+void inOrderBulk(BulkTree *tree);
+int isBalancedBST(BSTNode *root);
+
+BSTNode* dequeue(QueueNode **head, QueueNode **tail);
+void enqueue(QueueNode **head, QueueNode **tail, BSTNode *node);
+int isEmpty(QueueNode *head);
+void removeAll(BSTNode **node);
+
+int insertSortedLL(LinkedList *ll, int item);
+void printList(LinkedList *ll);
+void removeAllItems(LinkedList *ll);
+ListNode *findNode(LinkedList *ll, int index);
+int insertNode(LinkedList *ll, int index, int value);
+
+void benchmarkBulkLoad(int n);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j, m;
+	int *batch;
+	c = 1;
+
+	//Initialize the sorted input list and the tree as empty
+	LinkedList ll;
+	ll.head = NULL;
+	ll.size = 0;
+	BulkTree tree = { NULL, NULL, 0 };
+
+	printf("1: Insert an integer into the sorted input list;\n");
+	printf("2: Bulk-load the BST from the sorted list;\n");
+	printf("3: Merge a sorted batch of integers into the BST;\n");
+	printf("4: Print the level-order traversal of the BST;\n");
+	printf("5: Print the in-order traversal of the BST;\n");
+	printf("6: Run the bulk load vs insertBSTNode benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-6/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to add to the sorted list: ");
+			scanf("%d", &i);
+			insertSortedLL(&ll, i);
+			printf("The sorted input list is: ");
+			printList(&ll);
+			break;
+		case 2:
+			removeAllBulk(&tree);
+			i = buildBSTFromList(&tree, &ll);
+			printf("Built a balanced BST with %d nodes\n", i);
+			break;
+		case 3:
+			printf("Input the batch size followed by the sorted integers: ");
+			scanf("%d", &m);
+			if (m <= 0)
+				break;
+			batch = malloc(sizeof(int) * m);
+			if (batch == NULL)
+				break;
+			for (j = 0; j < m; j++)
+				scanf("%d", &batch[j]);
+			i = mergeSortedBatch(&tree, batch, m);
+			if (i == -1)
+				printf("The batch is not sorted\n");
+			else
+				printf("Merged %d new keys, the BST now has %d nodes\n", i, tree.size);
+			free(batch);
+			break;
+		case 4:
+			printf("The resulting level-order traversal of the BST is: ");
+			levelOrderTraversal(tree.root);
+			printf("\n");
+			break;
+		case 5:
+			printf("The resulting in-order traversal of the BST is: ");
+			inOrderBulk(&tree);
+			printf("\n");
+			break;
+		case 6:
+			printf("Input the number of keys: ");
+			scanf("%d", &i);
+			benchmarkBulkLoad(i);
+			break;
+		case 0:
+			removeAllBulk(&tree);
+			removeAllItems(&ll);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// nodes[lo..hi)의 가운데를 루트로, 양쪽 절반을 각각 서브트리로 연결
+// - 노드마다 한 번씩만 방문하므로 O(n), 재귀 깊이는 log2(n)
+static BSTNode* linkBalanced(BSTNode *nodes, int lo, int hi)
+{
+	int mid;
+
+	if (lo >= hi)
+		return NULL;
+	mid = lo + (hi - lo) / 2;
+	nodes[mid].left = linkBalanced(nodes, lo, mid);
+	nodes[mid].right = linkBalanced(nodes, mid + 1, hi);
+	return &nodes[mid];
+}
+
+static BSTNode* allocNodes(int count)
+{
+	BSTNode *nodes = malloc(sizeof(BSTNode) * (count > 0 ? count : 1));
+
+	if (nodes == NULL)
+		exit(0);
+	return nodes;
+}
+
+// Replaces tree with the keys of sorted[0..n); duplicates are kept once, like
+// insertBSTNode(). Returns the number of nodes, or -1 if the input is not sorted.
+int buildBSTFromArray(BulkTree *tree, const int *sorted, int n)
+{
+	int i, size = 0;
+
+	for (i = 1; i < n; i++)
+		if (sorted[i - 1] > sorted[i])
+			return -1;
+	removeAllBulk(tree);
+	if (n <= 0)
+		return 0;
+	tree->nodes = allocNodes(n);
+	for (i = 0; i < n; i++)
+		if (size == 0 || tree->nodes[size - 1].item != sorted[i])
+			tree->nodes[size++].item = sorted[i];
+	tree->size = size;
+	tree->root = linkBalanced(tree->nodes, 0, size);
+	return size;
+}
+
+// Same as buildBSTFromArray() for a sorted LinkedList; the list is not changed
+int buildBSTFromList(BulkTree *tree, LinkedList *ll)
+{
+	ListNode *cur;
+	int size = 0;
+
+	if (ll == NULL)
+		return -1;
+	for (cur = ll->head; cur != NULL && cur->next != NULL; cur = cur->next)
+		if (cur->item > cur->next->item)
+			return -1;
+	removeAllBulk(tree);
+	if (ll->head == NULL)
+		return 0;
+	tree->nodes = allocNodes(ll->size);
+	for (cur = ll->head; cur != NULL; cur = cur->next)
+		if (size == 0 || tree->nodes[size - 1].item != cur->item)
+			tree->nodes[size++].item = cur->item;
+	tree->size = size;
+	tree->root = linkBalanced(tree->nodes, 0, size);
+	return size;
+}
+
+// 정렬된 batch를 기존 트리에 합침: 루트에서 키마다 내려가는 대신
+// - 기존 키는 nodes[]에 이미 정렬되어 있으므로 두 배열을 한 번에 병합 (중복은 한 번만)
+// - 병합 결과로 새 블록을 만들고 다시 균형 트리로 연결 -> O(n + m)
+// Returns the number of keys added, or -1 if the batch is not sorted.
+int mergeSortedBatch(BulkTree *tree, const int *batch, int m)
+{
+	BSTNode *merged;
+	int i = 0, j = 0, size = 0, value;
+
+	for (j = 1; j < m; j++)
+		if (batch[j - 1] > batch[j])
+			return -1;
+	if (m <= 0)
+		return 0;
+
+	merged = allocNodes(tree->size + m);
+	j = 0;
+	while (i < tree->size || j < m) {
+		if (j == m || (i < tree->size && tree->nodes[i].item <= batch[j]))
+			value = tree->nodes[i++].item;
+		else
+			value = batch[j++];
+		if (size == 0 || merged[size - 1].item != value)
+			merged[size++].item = value;
+	}
+	// 중복이 있었으면 남는 자리를 돌려줌 (노드는 아직 연결 전이라 옮겨져도 됨)
+	if (size < tree->size + m) {
+		BSTNode *shrunk = realloc(merged, sizeof(BSTNode) * size);
+		if (shrunk != NULL)
+			merged = shrunk;
+	}
+
+	i = size - tree->size;
+	free(tree->nodes);
+	tree->nodes = merged;
+	tree->size = size;
+	tree->root = linkBalanced(merged, 0, size);
+	return i;
+}
+
+void removeAllBulk(BulkTree *tree)
+{
+	free(tree->nodes);
+	tree->root = NULL;
+	tree->nodes = NULL;
+	tree->size = 0;
+}
+
+// nodes[]가 곧 중위 순회 순서
+void inOrderBulk(BulkTree *tree)
+{
+	int i;
+
+	for (i = 0; i < tree->size; i++)
+		printf("%d ", tree->nodes[i].item);
+}
+
+// 모든 노드에서 좌우 높이 차가 1 이하이면 높이+1, 아니면 -1
+static int balancedHeight(BSTNode *node)
+{
+	int lh, rh;
+
+	if (node == NULL)
+		return 0;
+	lh = balancedHeight(node->left);
+	rh = balancedHeight(node->right);
+	if (lh == -1 || rh == -1 || lh - rh > 1 || rh - lh > 1)
+		return -1;
+	return 1 + (lh > rh ? lh : rh);
+}
+
+int isBalancedBST(BSTNode *root)
+{
+	return balancedHeight(root) != -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertBSTNode(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertBSTNode(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+void levelOrderTraversal(BSTNode* root)
+{
+	if (root == NULL)
+		return;
+	Queue *queue = (Queue*)malloc(sizeof(Queue));
+	queue->head = NULL;
+	queue->tail = NULL;
+	enqueue(&queue->head, &queue->tail, root);
+
+	while (!isEmpty(queue->head)) {
+		BSTNode *node = dequeue(&queue->head, &queue->tail);
+		printf("%d ", node->item);
+		if (node->left)
+			enqueue(&queue->head, &queue->tail, node->left);
+		if (node->right)
+			enqueue(&queue->head, &queue->tail, node->right);
+	}
+	free(queue);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// enqueue node
+void enqueue(QueueNode **headPtr, QueueNode **tailPtr, BSTNode *node)
+{
+	// dynamically allocate memory
+	QueueNode *newPtr = malloc(sizeof(QueueNode));
+
+	// if newPtr does not equal NULL
+	if (newPtr != NULL) {
+		newPtr->data = node;
+		newPtr->nextPtr = NULL;
+
+		// if queue is empty, insert at head
+		if (isEmpty(*headPtr)) {
+			*headPtr = newPtr;
+		}
+		else { // insert at tail
+			(*tailPtr)->nextPtr = newPtr;
+		}
+
+		*tailPtr = newPtr;
+	}
+	else {
+		printf("Node not inserted");
+	}
+}
+
+BSTNode* dequeue(QueueNode **headPtr, QueueNode **tailPtr)
+{
+	BSTNode *node = (*headPtr)->data;
+	QueueNode *tempPtr = *headPtr;
+	*headPtr = (*headPtr)->nextPtr;
+
+	if (*headPtr == NULL) {
+		*tailPtr = NULL;
+	}
+
+	free(tempPtr);
+
+	return node;
+}
+
+int isEmpty(QueueNode *head)
+{
+	return head == NULL;
+}
+
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Sorted linked list from Q1 of Section A
+
+int insertSortedLL(LinkedList *ll, int item)
+{
+	ListNode* cursor = ll->head;
+	int idx = 0;
+
+	while (cursor && cursor->item < item) {
+		cursor = cursor->next;
+		idx++;
+	}
+	if (cursor && cursor->item == item)
+		return -1;
+	if (insertNode(ll, idx, item) == -1)
+		return -1;
+	return idx;
+}
+
+void printList(LinkedList *ll){
+
+	ListNode *cur;
+	if (ll == NULL)
+		return;
+	cur = ll->head;
+
+	if (cur == NULL)
+		printf("Empty");
+	while (cur != NULL)
+	{
+		printf("%d ", cur->item);
+		cur = cur->next;
+	}
+	printf("\n");
+}
+
+void removeAllItems(LinkedList *ll)
+{
+	ListNode *cur = ll->head;
+	ListNode *tmp;
+
+	while (cur != NULL){
+		tmp = cur->next;
+		free(cur);
+		cur = tmp;
+	}
+	ll->head = NULL;
+	ll->size = 0;
+}
+
+ListNode *findNode(LinkedList *ll, int index){
+
+	ListNode *temp;
+
+	if (ll == NULL || index < 0 || index >= ll->size)
+		return NULL;
+
+	temp = ll->head;
+
+	if (temp == NULL || index < 0)
+		return NULL;
+
+	while (index > 0){
+		temp = temp->next;
+		if (temp == NULL)
+			return NULL;
+		index--;
+	}
+
+	return temp;
+}
+
+int insertNode(LinkedList *ll, int index, int value){
+
+	ListNode *pre, *cur;
+
+	if (ll == NULL || index < 0 || index > ll->size + 1)
+		return -1;
+
+	// If empty list or inserting first node, need to update head pointer
+	if (ll->head == NULL || index == 0){
+		cur = ll->head;
+		ll->head = malloc(sizeof(ListNode));
+		ll->head->item = value;
+		ll->head->next = cur;
+		ll->size++;
+		return 0;
+	}
+
+
+	// Find the nodes before and at the target position
+	// Create a new node and reconnect the links
+	if ((pre = findNode(ll, index - 1)) != NULL){
+		cur = pre->next;
+		pre->next = malloc(sizeof(ListNode));
+		pre->next->item = value;
+		pre->next->next = cur;
+		ll->size++;
+		return 0;
+	}
+
+	return -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void printRow(const char *name, double seconds, int n)
+{
+	printf("  %-36s %8.3f s %8.1f ns/key\n", name, seconds, seconds * 1e9 / n);
+}
+
+// 짝수 키 0, 2, ..., 2(n-1)로 트리를 만들고, 홀수 키 n/10개를 정렬된 batch로 합침
+// - 정렬 입력에 insertBSTNode를 쓰면 O(n^2)에 재귀 깊이도 n이라 n이 크면 건너뜀
+void benchmarkBulkLoad(int n)
+{
+	BulkTree tree = { NULL, NULL, 0 };
+	LinkedList ll;
+	ListNode *tail = NULL, *node;
+	BSTNode *root = NULL;
+	clock_t start;
+	int *keys, *shuffled, *batch;
+	int i, j, tmp, m = n / 10 > 0 ? n / 10 : 1;
+
+	if (n <= 0)
+		return;
+	keys = malloc(sizeof(int) * n);
+	shuffled = malloc(sizeof(int) * n);
+	batch = malloc(sizeof(int) * m);
+	if (keys == NULL || shuffled == NULL || batch == NULL) {
+		free(keys);
+		free(shuffled);
+		free(batch);
+		return;
+	}
+	for (i = 0; i < n; i++)
+		keys[i] = shuffled[i] = 2 * i;
+	for (i = n - 1; i > 0; i--) {
+		j = rand() % (i + 1);
+		tmp = shuffled[i];
+		shuffled[i] = shuffled[j];
+		shuffled[j] = tmp;
+	}
+	for (i = 0; i < m; i++)
+		batch[i] = 2 * (int)((long long)i * n / m) + 1;
+
+	ll.head = NULL;
+	ll.size = 0;
+	for (i = 0; i < n; i++) {
+		node = malloc(sizeof(ListNode));
+		if (node == NULL)
+			exit(0);
+		node->item = keys[i];
+		node->next = NULL;
+		if (tail == NULL)
+			ll.head = node;
+		else
+			tail->next = node;
+		tail = node;
+		ll.size++;
+	}
+
+	printf("n = %d, batch of %d keys:\n", n, m);
+	if (n <= 20000) {
+		start = clock();
+		for (i = 0; i < n; i++)
+			insertBSTNode(&root, keys[i]);
+		printRow("insertBSTNode, sorted input", elapsed(start), n);
+		removeAll(&root);
+	}
+	else {
+		printf("  insertBSTNode, sorted input: skipped (O(n^2))\n");
+	}
+
+	start = clock();
+	for (i = 0; i < n; i++)
+		insertBSTNode(&root, shuffled[i]);
+	printRow("insertBSTNode, shuffled input", elapsed(start), n);
+
+	start = clock();
+	buildBSTFromArray(&tree, keys, n);
+	printRow("buildBSTFromArray", elapsed(start), n);
+	removeAllBulk(&tree);
+
+	start = clock();
+	buildBSTFromList(&tree, &ll);
+	printRow("buildBSTFromList", elapsed(start), n);
+
+	start = clock();
+	for (i = 0; i < m; i++)
+		insertBSTNode(&root, batch[i]);
+	printRow("batch: insertBSTNode per key", elapsed(start), m);
+
+	start = clock();
+	i = mergeSortedBatch(&tree, batch, m);
+	printRow("batch: mergeSortedBatch", elapsed(start), m);
+	if (i != m || tree.size != n + m || !isBalancedBST(tree.root))
+		printf("  CHECK FAILED\n");
+
+	start = clock();
+	removeAll(&root);
+	printRow("release: removeAll", elapsed(start), n + m);
+	start = clock();
+	removeAllBulk(&tree);
+	printRow("release: removeAllBulk", elapsed(start), n + m);
+
+	removeAllItems(&ll);
+	free(keys);
+	free(shuffled);
+	free(batch);
+}
@@ -0,0 +1,1066 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: Concurrent BST ordered set with lock-free optimistic searches,
+		 per-node locks for insert/remove and epoch-based reclamation, a
+		 multi-thread consistency test, an insert/remove churn test and a 1-16
+		 thread scaling benchmark against one global mutex or rwlock.
+		 Build with: gcc -O2 -pthread */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define CACHE_LINE_SIZE 64
+#define MAX_THREADS 16			// callers pass a thread id in 0 .. MAX_THREADS - 1
+#define EPOCH_RETIRE_BATCH 64	// retirements between attempts to advance the epoch
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// Keys never move between nodes: a node with two children is only marked
+// deleted and keeps routing searches until it is left with at most one
+// child, and a node with at most one child is spliced out with its own
+// links left intact. The unlinked mark is set once
+// and never cleared, so a reader that still sees it clear after following a
+// link knows the node was in the tree when the link was read.
+typedef struct _cnode{
+	int item;
+	atomic_int deleted;					// logically removed, may still route
+	atomic_int unlinked;				// physically removed, links are frozen
+	atomic_int lock;					// taken by writers only, parent before child
+	_Atomic(struct _cnode*) child[2];	// 0: left, 1: right
+	struct _cnode *retiredNext;			// limbo list link
+} CNode;
+
+// state = (epoch << 1) | 1 while the thread is inside an operation, 0 outside.
+// A node retired when the global epoch was e can only be reached by threads
+// that entered at epoch e or earlier, so it is freed once the global epoch
+// reaches e + 2.
+typedef struct _epochrecord{
+	_Alignas(CACHE_LINE_SIZE) atomic_uint state;
+	CNode *limbo[3];					// retired nodes, by epoch % 3
+	unsigned int limboEpoch[3];
+	int retiredSinceAdvance;
+	long long retiredCount;				// only read once the owner has stopped
+	long long freedCount;
+} EpochRecord;
+
+typedef struct _concurrentbst{
+	CNode holder;					// holder.child[0] is the root, never removed
+	_Alignas(CACHE_LINE_SIZE) atomic_uint globalEpoch;
+	EpochRecord records[MAX_THREADS];
+} ConcurrentBST;
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;
+
+typedef struct _lockedbst{
+	pthread_mutex_t mutex;
+	pthread_rwlock_t rwlock;
+	BSTNode *root;
+} LockedBST;	// one big lock around the plain BST, only used by the benchmark
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void initConcurrentBST(ConcurrentBST *tree);
+void destroyConcurrentBST(ConcurrentBST *tree);
+int insertBSTNode(ConcurrentBST *tree, int tid, int value);
+int removeNodeFromTree(ConcurrentBST *tree, int tid, int value);
+int searchBSTNode(ConcurrentBST *tree, int tid, int value);
+void inOrderTraversal(ConcurrentBST *tree);
+int checkConcurrentBST(ConcurrentBST *tree);
+int countPhysicalNodes(ConcurrentBST *tree);
+
+int concurrencyTest(int threads, int keysPerThread);
+int churnTest(int threads, int keys, int rounds);
+void benchmarkScaling(int keyRange, int totalOps);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j, k;
+	ConcurrentBST tree;
+	c = 1;
+
+	//Initialize the concurrent Binary Search Tree as an empty tree
+	initConcurrentBST(&tree);
+
+	printf("1: Insert an integer into the binary search tree;\n");
+	printf("2: Remove an integer from the binary search tree;\n");
+	printf("3: Search for an integer in the binary search tree;\n");
+	printf("4: Print the in-order traversal of the binary search tree;\n");
+	printf("5: Run the multi-thread consistency test;\n");
+	printf("6: Run the 1-16 thread scaling benchmark;\n");
+	printf("7: Run the insert/remove churn test;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-7/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the Binary Search Tree: ");
+			scanf("%d", &i);
+			if (insertBSTNode(&tree, 0, i) == 0)
+				printf("%d is already in the tree\n", i);
+			break;
+		case 2:
+			printf("Input an integer that you want to remove from the Binary Search Tree: ");
+			scanf("%d", &i);
+			if (removeNodeFromTree(&tree, 0, i) == 0)
+				printf("%d is not in the tree\n", i);
+			break;
+		case 3:
+			printf("Input an integer that you want to search for: ");
+			scanf("%d", &i);
+			if (searchBSTNode(&tree, 0, i))
+				printf("%d is in the tree\n", i);
+			else
+				printf("%d is not in the tree\n", i);
+			break;
+		case 4:
+			printf("The resulting in-order traversal of the binary search tree is: ");
+			inOrderTraversal(&tree);
+			printf("\n");
+			break;
+		case 5:
+			printf("Input the number of threads and the keys per thread: ");
+			scanf("%d %d", &i, &j);
+			if (concurrencyTest(i, j))
+				printf("Test passed: every search and the final tree were consistent\n");
+			else
+				printf("Test FAILED\n");
+			break;
+		case 6:
+			printf("Input the key range and the total number of operations: ");
+			scanf("%d %d", &i, &j);
+			benchmarkScaling(i, j);
+			break;
+		case 7:
+			printf("Input the number of threads, the number of keys and the number of rounds: ");
+			scanf("%d %d %d", &i, &j, &k);
+			if (churnTest(i, j, k))
+				printf("Test passed: the physical node count stayed bounded\n");
+			else
+				printf("Test FAILED\n");
+			break;
+		case 0:
+			destroyConcurrentBST(&tree);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 노드마다 pthread_mutex_t(40바이트)를 두면 노드가 두 배로 커지므로 4바이트 스핀락 사용
+// - 잠금 구간이 포인터 몇 개를 바꾸는 정도라 짧게 돌다가 안 되면 CPU를 양보
+static void lockNode(CNode *node)
+{
+	int spins = 0;
+
+	while (atomic_exchange_explicit(&node->lock, 1, memory_order_acquire)) {
+		while (atomic_load_explicit(&node->lock, memory_order_relaxed)) {
+			if (++spins >= 64) {
+				sched_yield();
+				spins = 0;
+			}
+		}
+	}
+}
+
+static void unlockNode(CNode *node)
+{
+	atomic_store_explicit(&node->lock, 0, memory_order_release);
+}
+
+static void initNode(CNode *node, int value)
+{
+	node->item = value;
+	atomic_init(&node->deleted, 0);
+	atomic_init(&node->unlinked, 0);
+	atomic_init(&node->child[0], NULL);
+	atomic_init(&node->child[1], NULL);
+	atomic_init(&node->lock, 0);
+	node->retiredNext = NULL;
+}
+
+void initConcurrentBST(ConcurrentBST *tree)
+{
+	int t, b;
+
+	initNode(&tree->holder, 0);
+	atomic_init(&tree->globalEpoch, 0);
+	for (t = 0; t < MAX_THREADS; t++) {
+		atomic_init(&tree->records[t].state, 0);
+		for (b = 0; b < 3; b++) {
+			tree->records[t].limbo[b] = NULL;
+			tree->records[t].limboEpoch[b] = 0;
+		}
+		tree->records[t].retiredSinceAdvance = 0;
+		tree->records[t].retiredCount = 0;
+		tree->records[t].freedCount = 0;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// LockFreeSkipList_A_LL.c와 같은 3칸 epoch 방식
+// 연산 시작: 지금의 전역 epoch를 active로 공개
+// - store 다음의 seq_cst fence와 tryAdvanceEpoch의 fence가 짝을 이룸: 떼어내는 쪽이
+//   state를 0으로 읽었다면 이 스레드의 이후 링크 읽기는 그 떼어내기 뒤의 링크를 봄
+//   (store 하나만 seq_cst로는 뒤의 acquire 읽기가 store보다 먼저 보일 수 있음)
+static void enterEpoch(ConcurrentBST *tree, int tid)
+{
+	unsigned int e = atomic_load(&tree->globalEpoch);
+
+	atomic_store(&tree->records[tid].state, (e << 1) | 1);
+	atomic_thread_fence(memory_order_seq_cst);
+}
+
+static void exitEpoch(ConcurrentBST *tree, int tid)
+{
+	atomic_store_explicit(&tree->records[tid].state, 0, memory_order_release);
+}
+
+// active인 스레드가 모두 현재 epoch에 들어와 있을 때만 한 칸 올림
+// - 앞서 한 링크 변경이 state를 읽기 전에 모두에게 보이도록 fence
+static void tryAdvanceEpoch(ConcurrentBST *tree)
+{
+	unsigned int e = atomic_load(&tree->globalEpoch);
+	unsigned int s;
+	int t;
+
+	atomic_thread_fence(memory_order_seq_cst);
+	for (t = 0; t < MAX_THREADS; t++) {
+		s = atomic_load(&tree->records[t].state);
+		if ((s & 1) && (s >> 1) != e)
+			return;
+	}
+	atomic_compare_exchange_strong(&tree->globalEpoch, &e, e + 1);
+}
+
+static void freeChain(EpochRecord *rec, CNode *node)
+{
+	CNode *next;
+
+	while (node != NULL) {
+		next = node->retiredNext;
+		free(node);
+		rec->freedCount++;
+		node = next;
+	}
+}
+
+// 떼어낸 노드는 아직 누가 읽고 있을 수 있으므로 지금 epoch의 limbo에 넣음
+// - 같은 칸에 3 epoch 전 노드가 남아 있으면 전역 epoch가 이미 2 이상 앞서므로 먼저 해제
+static void retireNode(ConcurrentBST *tree, int tid, CNode *node)
+{
+	EpochRecord *rec = &tree->records[tid];
+	unsigned int e = atomic_load(&tree->globalEpoch);
+	int b = e % 3;
+
+	if (rec->limboEpoch[b] != e) {
+		freeChain(rec, rec->limbo[b]);
+		rec->limbo[b] = NULL;
+		rec->limboEpoch[b] = e;
+	}
+	node->retiredNext = rec->limbo[b];
+	rec->limbo[b] = node;
+	rec->retiredCount++;
+
+	if (++rec->retiredSinceAdvance >= EPOCH_RETIRE_BATCH) {
+		rec->retiredSinceAdvance = 0;
+		tryAdvanceEpoch(tree);
+		e = atomic_load(&tree->globalEpoch);
+		for (b = 0; b < 3; b++) {
+			if (rec->limbo[b] != NULL && e - rec->limboEpoch[b] >= 2) {
+				freeChain(rec, rec->limbo[b]);
+				rec->limbo[b] = NULL;
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 잠금 없이 value의 자리를 찾음
+// - 링크를 읽은 뒤 그 노드의 unlinked가 아직 0이면 읽는 순간 트리 안에 있던 링크
+// - 이미 떼어낸 노드를 만나면 그 아래는 더 이상 갱신되지 않으므로 루트부터 다시
+// 찾으면 그 노드, 없으면 NULL을 돌려주고 *parent, *dir에 마지막 부모와 방향을 남김
+static CNode* findNode(ConcurrentBST *tree, int value, CNode **parent, int *dir)
+{
+	CNode *node, *next;
+	int d;
+
+retry:
+	node = &tree->holder;
+	d = 0;
+	for (;;) {
+		next = atomic_load(&node->child[d]);
+		if (atomic_load(&node->unlinked))
+			goto retry;
+		*parent = node;
+		*dir = d;
+		if (next == NULL || next->item == value)
+			return next;
+		node = next;
+		d = value > node->item;
+	}
+}
+
+// Returns 1 if value was present, 0 otherwise; never takes a lock
+int searchBSTNode(ConcurrentBST *tree, int tid, int value)
+{
+	CNode *parent, *node;
+	int dir, found;
+
+	enterEpoch(tree, tid);
+	node = findNode(tree, value, &parent, &dir);
+	// deleted는 떼어내기 전에 먼저 1이 되므로 0이면 아직 트리 안에 있음
+	found = node != NULL && !atomic_load(&node->deleted);
+	exitEpoch(tree, tid);
+	return found;
+}
+
+// Returns 1 if value was added, 0 if it was already present
+int insertBSTNode(ConcurrentBST *tree, int tid, int value)
+{
+	CNode *parent, *node, *newNode;
+	int dir, revived;
+
+	enterEpoch(tree, tid);
+	for (;;) {
+		node = findNode(tree, value, &parent, &dir);
+		if (node != NULL) {
+			if (!atomic_load(&node->deleted)) {
+				exitEpoch(tree, tid);
+				return 0;
+			}
+			// 삭제 표시만 된 노드는 되살림
+			lockNode(node);
+			if (atomic_load(&node->unlinked)) {
+				unlockNode(node);
+				continue;
+			}
+			revived = atomic_load(&node->deleted);
+			atomic_store(&node->deleted, 0);
+			unlockNode(node);
+			exitEpoch(tree, tid);
+			return revived;
+		}
+
+		// 부모가 그대로 트리 안에 있고 그 자리가 아직 비어 있을 때만 연결
+		lockNode(parent);
+		if (atomic_load(&parent->unlinked) || atomic_load(&parent->child[dir]) != NULL) {
+			unlockNode(parent);
+			continue;
+		}
+		newNode = malloc(sizeof(CNode));
+		if (newNode == NULL)
+			exit(0);
+		initNode(newNode, value);
+		atomic_store(&parent->child[dir], newNode);
+		unlockNode(parent);
+		exitEpoch(tree, tid);
+		return 1;
+	}
+}
+
+// node는 parent와 함께 잠겨 있어야 함 - 삭제 표시만 남은 길 안내 노드인데
+// 자식이 하나 이하가 되었으면 이제 떼어낼 수 있음
+static int isStaleRouting(ConcurrentBST *tree, CNode *node)
+{
+	return node != &tree->holder && atomic_load(&node->deleted)
+		&& (atomic_load(&node->child[0]) == NULL || atomic_load(&node->child[1]) == NULL);
+}
+
+// 자식을 떼어낸 뒤 길 안내 노드 target이 자식 하나 이하로 남았으면 조부모 -> target
+// 순으로 잠그고 떼어냄, 그러면 조부모도 같은 처지가 될 수 있으므로 위로 반복
+// - 호출한 쪽이 epoch 안에 있으므로 target이 떼어내졌어도 아직 해제되지 않음
+static void unlinkRouting(ConcurrentBST *tree, int tid, CNode *target)
+{
+	CNode *parent, *node, *left, *right;
+	int dir;
+
+	while (target != NULL) {
+		node = findNode(tree, target->item, &parent, &dir);
+		if (node != target)
+			return;		// 다른 스레드가 이미 떼어냄
+		lockNode(parent);
+		lockNode(node);
+		if (atomic_load(&parent->unlinked) || atomic_load(&node->unlinked)
+			|| atomic_load(&parent->child[dir]) != node) {
+			unlockNode(node);
+			unlockNode(parent);
+			continue;
+		}
+		if (!isStaleRouting(tree, node)) {
+			// 되살아났거나 그사이 자식이 다시 둘이 됨
+			unlockNode(node);
+			unlockNode(parent);
+			return;
+		}
+		left = atomic_load(&node->child[0]);
+		right = atomic_load(&node->child[1]);
+		atomic_store(&parent->child[dir], left != NULL ? left : right);
+		atomic_store(&node->unlinked, 1);
+		target = isStaleRouting(tree, parent) ? parent : NULL;
+		unlockNode(node);
+		unlockNode(parent);
+		retireNode(tree, tid, node);
+	}
+}
+
+// Returns 1 if value was removed, 0 if it was not present
+// - 자식이 둘이면 삭제 표시만 하고 길 안내용으로 남김 (키를 옮기지 않음)
+// - 자식이 하나 이하면 부모 -> 노드 순으로 잠그고 부모 링크를 자식으로 바꿔서 떼어냄
+int removeNodeFromTree(ConcurrentBST *tree, int tid, int value)
+{
+	CNode *parent, *node, *left, *right, *stale;
+	int dir;
+
+	enterEpoch(tree, tid);
+	for (;;) {
+		node = findNode(tree, value, &parent, &dir);
+		if (node == NULL || atomic_load(&node->deleted)) {
+			exitEpoch(tree, tid);
+			return 0;
+		}
+
+		lockNode(parent);
+		lockNode(node);
+		if (atomic_load(&parent->unlinked) || atomic_load(&node->unlinked)
+			|| atomic_load(&parent->child[dir]) != node) {
+			unlockNode(node);
+			unlockNode(parent);
+			continue;
+		}
+		if (atomic_load(&node->deleted)) {
+			unlockNode(node);
+			unlockNode(parent);
+			exitEpoch(tree, tid);
+			return 0;
+		}
+		atomic_store(&node->deleted, 1);
+		left = atomic_load(&node->child[0]);
+		right = atomic_load(&node->child[1]);
+		stale = NULL;
+		if (left == NULL || right == NULL) {
+			atomic_store(&parent->child[dir], left != NULL ? left : right);
+			atomic_store(&node->unlinked, 1);
+			if (isStaleRouting(tree, parent))
+				stale = parent;
+		}
+		unlockNode(node);
+		unlockNode(parent);
+
+		if (left == NULL || right == NULL)
+			retireNode(tree, tid, node);
+		if (stale != NULL)
+			unlinkRouting(tree, tid, stale);
+		exitEpoch(tree, tid);
+		return 1;
+	}
+}
+
+// removeAll()과 같은 회전 방식의 해제, 다른 스레드가 없을 때만 호출
+// - 트리에 남은 노드와 모든 스레드의 limbo를 해제
+void destroyConcurrentBST(ConcurrentBST *tree)
+{
+	CNode *cur = atomic_load(&tree->holder.child[0]), *next;
+	int t, b;
+
+	while (cur != NULL) {
+		if (atomic_load(&cur->child[0]) == NULL) {
+			next = atomic_load(&cur->child[1]);
+			free(cur);
+		}
+		else {
+			next = atomic_load(&cur->child[0]);
+			atomic_store(&cur->child[0], atomic_load(&next->child[1]));
+			atomic_store(&next->child[1], cur);
+		}
+		cur = next;
+	}
+	atomic_store(&tree->holder.child[0], NULL);
+	for (t = 0; t < MAX_THREADS; t++) {
+		for (b = 0; b < 3; b++) {
+			freeChain(&tree->records[t], tree->records[t].limbo[b]);
+			tree->records[t].limbo[b] = NULL;
+		}
+	}
+}
+
+static void inOrderNodes(CNode *node)
+{
+	if (node == NULL)
+		return;
+	inOrderNodes(atomic_load(&node->child[0]));
+	if (!atomic_load(&node->deleted))
+		printf("%d ", node->item);
+	inOrderNodes(atomic_load(&node->child[1]));
+}
+
+// Only meaningful while no other thread is using the tree
+void inOrderTraversal(ConcurrentBST *tree)
+{
+	inOrderNodes(atomic_load(&tree->holder.child[0]));
+}
+
+// 모든 노드가 (lo, hi) 범위 안에 있는지, 떼어낸 노드가 남아 있지 않은지 확인
+// - 삭제 표시된 노드는 자식이 둘일 때만 남아 있어야 함 (아니면 떼어냈어야 함)
+static int checkNodes(CNode *node, long long lo, long long hi)
+{
+	int left, right;
+
+	if (node == NULL)
+		return 0;
+	if (node->item <= lo || node->item >= hi || atomic_load(&node->unlinked))
+		return -1;
+	if (atomic_load(&node->deleted) && (atomic_load(&node->child[0]) == NULL
+		|| atomic_load(&node->child[1]) == NULL))
+		return -1;
+	left = checkNodes(atomic_load(&node->child[0]), lo, node->item);
+	right = checkNodes(atomic_load(&node->child[1]), node->item, hi);
+	if (left == -1 || right == -1)
+		return -1;
+	return left + right + !atomic_load(&node->deleted);
+}
+
+// Returns the number of keys in the set, or -1 if the tree is not a valid
+// BST; only meaningful while no other thread is using the tree
+int checkConcurrentBST(ConcurrentBST *tree)
+{
+	return checkNodes(atomic_load(&tree->holder.child[0]), -2147483649LL, 2147483648LL);
+}
+
+static int countNodes(CNode *node)
+{
+	if (node == NULL)
+		return 0;
+	return 1 + countNodes(atomic_load(&node->child[0])) + countNodes(atomic_load(&node->child[1]));
+}
+
+// Counts every node still linked into the tree, including deleted routing
+// nodes; only meaningful while no other thread is using the tree
+int countPhysicalNodes(ConcurrentBST *tree)
+{
+	return countNodes(atomic_load(&tree->holder.child[0]));
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Plain BST behind one lock, the way the services share it today
+
+static void insertPlain(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertPlain(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertPlain(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+static BSTNode* removePlain(BSTNode *root, int value) {
+	BSTNode *temp, *successor;
+
+	if (root == NULL)
+		return NULL;
+
+	if (value < root->item) {
+		root->left = removePlain(root->left, value);
+	}
+	else if (value > root->item) {
+		root->right = removePlain(root->right, value);
+	}
+	else {
+		if (root->left == NULL) {
+			temp = root->right;
+			free(root);
+			return temp;
+		}
+		else if (root->right == NULL) {
+			temp = root->left;
+			free(root);
+			return temp;
+		}
+		successor = root->right;
+		while (successor->left != NULL)
+			successor = successor->left;
+		root->item = successor->item;
+		root->right = removePlain(root->right, successor->item);
+	}
+	return root;
+}
+
+static int searchPlain(BSTNode *node, int value)
+{
+	while (node != NULL) {
+		if (value == node->item)
+			return 1;
+		node = value < node->item ? node->left : node->right;
+	}
+	return 0;
+}
+
+static void removeAllPlain(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static unsigned int fmix32(unsigned int h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+static unsigned int nextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+typedef struct _testworker
+{
+	ConcurrentBST *tree;
+	int id;
+	int threads;
+	int keysPerThread;
+	const int *order;		// shuffled 0..keysPerThread-1, so the tree stays shallow
+	atomic_int *ok;
+} TestWorker;
+
+// 스레드 t는 i * threads + t 꼴의 키만 넣고 빼므로 자기 키의 상태는 항상 알 수 있음
+// - 음수 키 -1..-keysPerThread는 시작 전에 넣고 지우지 않으므로 언제 찾아도 있어야 함
+static void *testMain(void *arg)
+{
+	TestWorker *me = arg;
+	unsigned int rng = fmix32(me->id + 1);
+	int i, key, stable;
+
+	for (i = 0; i < me->keysPerThread; i++) {
+		key = me->order[(i + me->id) % me->keysPerThread] * me->threads + me->id;
+		if (insertBSTNode(me->tree, me->id, key) != 1 || !searchBSTNode(me->tree, me->id, key))
+			atomic_store(me->ok, 0);
+		stable = -1 - (int)(nextRandom(&rng) % me->keysPerThread);
+		if (!searchBSTNode(me->tree, me->id, stable))
+			atomic_store(me->ok, 0);
+	}
+	for (i = 0; i < me->keysPerThread; i += 2) {
+		key = i * me->threads + me->id;	// 짝수 번째 키만 지움
+		if (removeNodeFromTree(me->tree, me->id, key) != 1 || searchBSTNode(me->tree, me->id, key))
+			atomic_store(me->ok, 0);
+		if (removeNodeFromTree(me->tree, me->id, key) != 0)
+			atomic_store(me->ok, 0);
+		stable = -1 - (int)(nextRandom(&rng) % me->keysPerThread);
+		if (!searchBSTNode(me->tree, me->id, stable))
+			atomic_store(me->ok, 0);
+	}
+	return NULL;
+}
+
+// 끝난 뒤 트리가 BST 조건을 지키고, 남은 키가 정확히 예상한 집합인지 확인
+int concurrencyTest(int threads, int keysPerThread)
+{
+	ConcurrentBST tree;
+	pthread_t tid[MAX_THREADS];
+	TestWorker workers[MAX_THREADS];
+	atomic_int ok;
+	unsigned int rng = 12345;
+	int *order;
+	int i, j, tmp, t, expected;
+
+	if (threads <= 0 || threads > MAX_THREADS || keysPerThread <= 0)
+		return 0;
+	if (keysPerThread > 0x7fffffff / threads)
+		return 0;
+	order = malloc(sizeof(int) * keysPerThread);
+	if (order == NULL)
+		return 0;
+	initConcurrentBST(&tree);
+	atomic_init(&ok, 1);
+
+	// 키를 섞어서 넣어야 트리가 사슬이 되지 않음
+	for (i = 0; i < keysPerThread; i++)
+		order[i] = i;
+	for (i = keysPerThread - 1; i > 0; i--) {
+		j = nextRandom(&rng) % (i + 1);
+		tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+	for (i = 0; i < keysPerThread; i++)
+		insertBSTNode(&tree, 0, -1 - order[i]);
+
+	for (t = 0; t < threads; t++) {
+		workers[t].tree = &tree;
+		workers[t].id = t;
+		workers[t].threads = threads;
+		workers[t].keysPerThread = keysPerThread;
+		workers[t].order = order;
+		workers[t].ok = &ok;
+		if (pthread_create(&tid[t], NULL, testMain, &workers[t]) != 0)
+			exit(0);
+	}
+	for (t = 0; t < threads; t++)
+		pthread_join(tid[t], NULL);
+
+	expected = keysPerThread + threads * (keysPerThread / 2);
+	if (checkConcurrentBST(&tree) != expected)
+		atomic_store(&ok, 0);
+	for (t = 0; t < threads; t++) {
+		for (i = 0; i < keysPerThread; i++) {
+			if (searchBSTNode(&tree, 0, i * threads + t) != (i % 2 == 1))
+				atomic_store(&ok, 0);
+		}
+	}
+
+	destroyConcurrentBST(&tree);
+	free(order);
+	return atomic_load(&ok);
+}
+
+typedef struct _churnworker
+{
+	ConcurrentBST *tree;
+	int id;
+	int threads;
+	int keys;
+	int round;
+	unsigned char *present;	// each thread only touches its own keys
+	atomic_int *ok;
+} ChurnWorker;
+
+// 자기 키(key % threads == id) 중 하나를 골라 있으면 지우고 없으면 넣음
+static void *churnMain(void *arg)
+{
+	ChurnWorker *me = arg;
+	unsigned int rng = fmix32(me->id * 7919 + me->round * 104729 + 1);
+	int own = (me->keys - me->id + me->threads - 1) / me->threads;
+	int i, key;
+
+	if (own <= 0)
+		return NULL;
+	for (i = 0; i < 2 * own; i++) {
+		key = (int)(nextRandom(&rng) % own) * me->threads + me->id;
+		if (me->present[key]) {
+			if (removeNodeFromTree(me->tree, me->id, key) != 1 || searchBSTNode(me->tree, me->id, key))
+				atomic_store(me->ok, 0);
+			me->present[key] = 0;
+		}
+		else {
+			if (insertBSTNode(me->tree, me->id, key) != 1 || !searchBSTNode(me->tree, me->id, key))
+				atomic_store(me->ok, 0);
+			me->present[key] = 1;
+		}
+	}
+	return NULL;
+}
+
+// 라운드마다 모든 스레드가 자기 키를 넣고 빼기를 반복한 뒤 멈춘 상태에서 확인
+// - 삭제 표시된 노드는 자식이 둘일 때만 남으므로 그런 노드는 잎보다 적고,
+//   트리 안의 노드 수는 살아 있는 키 수의 두 배를 넘을 수 없음
+// - 떼어낸 노드는 중간에 전체를 멈추지 않아도 epoch가 넘어가면서 해제되어야 함
+int churnTest(int threads, int keys, int rounds)
+{
+	ConcurrentBST tree;
+	pthread_t tid[MAX_THREADS];
+	ChurnWorker workers[MAX_THREADS];
+	atomic_int ok;
+	unsigned char *present;
+	unsigned int rng = 12345;
+	long long retired = 0, freed = 0;
+	int *order;
+	int i, j, tmp, t, r, live, physical, maxPhysical = 0;
+
+	if (threads <= 0 || threads > MAX_THREADS || keys <= 0 || rounds <= 0)
+		return 0;
+	order = malloc(sizeof(int) * keys);
+	present = calloc(keys, 1);
+	if (order == NULL || present == NULL) {
+		free(order);
+		free(present);
+		return 0;
+	}
+	initConcurrentBST(&tree);
+	atomic_init(&ok, 1);
+
+	// 섞은 순서로 절반쯤 미리 넣음
+	for (i = 0; i < keys; i++)
+		order[i] = i;
+	for (i = keys - 1; i > 0; i--) {
+		j = nextRandom(&rng) % (i + 1);
+		tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+	for (i = 0; i < keys; i++) {
+		if (nextRandom(&rng) & 1) {
+			insertBSTNode(&tree, 0, order[i]);
+			present[order[i]] = 1;
+		}
+	}
+
+	for (r = 0; r < rounds; r++) {
+		for (t = 0; t < threads; t++) {
+			workers[t].tree = &tree;
+			workers[t].id = t;
+			workers[t].threads = threads;
+			workers[t].keys = keys;
+			workers[t].round = r;
+			workers[t].present = present;
+			workers[t].ok = &ok;
+			if (pthread_create(&tid[t], NULL, churnMain, &workers[t]) != 0)
+				exit(0);
+		}
+		for (t = 0; t < threads; t++)
+			pthread_join(tid[t], NULL);
+
+		live = 0;
+		for (i = 0; i < keys; i++)
+			live += present[i];
+		physical = countPhysicalNodes(&tree);
+		if (physical > maxPhysical)
+			maxPhysical = physical;
+		if (checkConcurrentBST(&tree) != live || physical > 2 * live)
+			atomic_store(&ok, 0);
+	}
+
+	for (t = 0; t < MAX_THREADS; t++) {
+		retired += tree.records[t].retiredCount;
+		freed += tree.records[t].freedCount;
+	}
+	printf("%d rounds: %d live keys, at most %d nodes in the tree; %lld nodes retired, %lld freed while running\n",
+		rounds, live, maxPhysical, retired, freed);
+	// 스레드마다 limbo에 남는 건 몇 epoch 분량뿐이어야 함
+	if (retired >= 16LL * EPOCH_RETIRE_BATCH * threads && freed * 2 < retired)
+		atomic_store(&ok, 0);
+
+	destroyConcurrentBST(&tree);
+	free(order);
+	free(present);
+	return atomic_load(&ok);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _workload
+{
+	ConcurrentBST *tree;	// exactly one of tree / locked is set
+	LockedBST *locked;
+	int useRwlock;
+	int keyRange;
+	int readPercent;
+	int opsPerThread;
+} Workload;
+
+typedef struct _worker
+{
+	Workload *w;
+	int id;
+	long long found;
+} Worker;
+
+static void *benchMain(void *arg)
+{
+	Worker *me = arg;
+	Workload *w = me->w;
+	unsigned int rng = fmix32(me->id * 7919 + 1);
+	unsigned int r;
+	int i, key, op;
+
+	for (i = 0; i < w->opsPerThread; i++) {
+		r = nextRandom(&rng);
+		key = (int)((r >> 8) % w->keyRange);
+		// 쓰기는 삽입과 삭제를 반씩 -> 트리 크기가 keyRange / 2 근처로 유지됨
+		op = r % 100 < (unsigned int)w->readPercent ? 0 : (r & 0x80) ? 1 : 2;
+		if (w->tree != NULL) {
+			if (op == 0)
+				me->found += searchBSTNode(w->tree, me->id, key);
+			else if (op == 1)
+				insertBSTNode(w->tree, me->id, key);
+			else
+				removeNodeFromTree(w->tree, me->id, key);
+		}
+		else if (op == 0) {
+			if (w->useRwlock)
+				pthread_rwlock_rdlock(&w->locked->rwlock);
+			else
+				pthread_mutex_lock(&w->locked->mutex);
+			me->found += searchPlain(w->locked->root, key);
+			if (w->useRwlock)
+				pthread_rwlock_unlock(&w->locked->rwlock);
+			else
+				pthread_mutex_unlock(&w->locked->mutex);
+		}
+		else {
+			if (w->useRwlock)
+				pthread_rwlock_wrlock(&w->locked->rwlock);
+			else
+				pthread_mutex_lock(&w->locked->mutex);
+			if (op == 1)
+				insertPlain(&w->locked->root, key);
+			else
+				w->locked->root = removePlain(w->locked->root, key);
+			if (w->useRwlock)
+				pthread_rwlock_unlock(&w->locked->rwlock);
+			else
+				pthread_mutex_unlock(&w->locked->mutex);
+		}
+	}
+	return NULL;
+}
+
+static double nowSeconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double runWorkload(Workload *w, int threads)
+{
+	pthread_t tid[MAX_THREADS];
+	Worker workers[MAX_THREADS];
+	double start;
+	int i;
+
+	for (i = 0; i < threads; i++) {
+		workers[i].w = w;
+		workers[i].id = i;
+		workers[i].found = 0;
+	}
+	start = nowSeconds();
+	for (i = 0; i < threads; i++) {
+		if (pthread_create(&tid[i], NULL, benchMain, &workers[i]) != 0)
+			exit(0);
+	}
+	for (i = 0; i < threads; i++)
+		pthread_join(tid[i], NULL);
+	return nowSeconds() - start;
+}
+
+// 같은 무작위 절반 키로 미리 채운 트리에 1, 2, 4, 8, 16개 스레드로 totalOps개 연산 실행
+void benchmarkScaling(int keyRange, int totalOps)
+{
+	static const int mixes[] = { 90, 50 };
+	static const char *names[] = { "global mutex", "global rwlock", "optimistic" };
+	ConcurrentBST tree;
+	LockedBST locked;
+	Workload w;
+	unsigned int rng;
+	double seconds;
+	int mix, threads, kind, i;
+
+	if (keyRange <= 0 || totalOps <= 0)
+		return;
+	for (mix = 0; mix < 2; mix++) {
+		printf("%d%% search / %d%% insert+remove, %d keys:\n", mixes[mix], 100 - mixes[mix], keyRange);
+		printf("  threads   %14s   %14s   %14s   (M ops/s)\n", names[0], names[1], names[2]);
+		for (threads = 1; threads <= MAX_THREADS; threads *= 2) {
+			printf("  %7d", threads);
+			for (kind = 0; kind < 3; kind++) {
+				w.tree = NULL;
+				w.locked = NULL;
+				w.useRwlock = kind == 1;
+				w.keyRange = keyRange;
+				w.readPercent = mixes[mix];
+				w.opsPerThread = totalOps / threads;
+
+				rng = 2463534242u;
+				if (kind == 2) {
+					initConcurrentBST(&tree);
+					for (i = 0; i < keyRange / 2; i++)
+						insertBSTNode(&tree, 0, (int)(nextRandom(&rng) % keyRange));
+					w.tree = &tree;
+				}
+				else {
+					pthread_mutex_init(&locked.mutex, NULL);
+					pthread_rwlock_init(&locked.rwlock, NULL);
+					locked.root = NULL;
+					for (i = 0; i < keyRange / 2; i++)
+						insertPlain(&locked.root, (int)(nextRandom(&rng) % keyRange));
+					w.locked = &locked;
+				}
+
+				seconds = runWorkload(&w, threads);
+				printf("   %14.2f", seconds > 0 ? (double)w.opsPerThread * threads / seconds / 1e6 : 0.0);
+
+				if (kind == 2) {
+					if (checkConcurrentBST(&tree) == -1)
+						printf(" (CHECK FAILED)");
+					destroyConcurrentBST(&tree);
+				}
+				else {
+					removeAllPlain(&locked.root);
+					pthread_rwlock_destroy(&locked.rwlock);
+					pthread_mutex_destroy(&locked.mutex);
+				}
+			}
+			printf("\n");
+		}
+	}
+}
@@ -0,0 +1,547 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: Freeze a read-only BSTNode tree into a pointer-free array in Eytzinger
+		 (BFS) or van Emde Boas order, with branchless prefetching search and
+		 array-based level-order/in-order traversals */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define EYTZINGER 0
+#define VEB 1
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;
+
+// The frozen tree is the complete BST over the same keys, so its shape is
+// balanced even if the source tree was not. Nodes are numbered in BFS order
+// from 1 (children of i are 2i and 2i+1); only the placement differs:
+// - EYTZINGER: keys[i] is node i
+// - VEB: nodes are stored recursively (top half-tree, then each bottom
+//   half-tree), located through the per-depth tables below
+typedef struct _frozenbst{
+	int *keys;
+	int n;
+	int layout;
+	int height;				// levels of the complete tree
+	int vebTop[32];			// per depth d: size of the top tree above d
+	int vebBottom[32];		// size of each bottom tree rooted at depth d
+	int vebRootDepth[32];	// depth of the root of that top tree
+} FrozenBST;
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value);
+void freezeBST(BSTNode *root, FrozenBST *frozen, int layout);
+int searchFrozen(FrozenBST *frozen, int value);
+void levelOrderFrozen(FrozenBST *frozen);
+void inOrderFrozen(FrozenBST *frozen);
+void freeFrozen(FrozenBST *frozen);
+void removeAll(BSTNode **node);
+
+void benchmarkFrozen(int n, int queries);
+void checkLeftSpine(int depth);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j;
+	c = 1;
+
+	//Initialize the Binary Search Tree as an empty Binary Search Tree
+	BSTNode *root;
+	root = NULL;
+	FrozenBST frozen = { NULL, 0, EYTZINGER, 0, { 0 }, { 0 }, { 0 } };
+
+	printf("1: Insert an integer into the binary search tree;\n");
+	printf("2: Freeze the tree in Eytzinger (BFS) layout;\n");
+	printf("3: Freeze the tree in van Emde Boas layout;\n");
+	printf("4: Print the level-order traversal of the frozen tree;\n");
+	printf("5: Print the in-order traversal of the frozen tree;\n");
+	printf("6: Search for an integer in the frozen tree;\n");
+	printf("7: Run the frozen vs pointer-based search benchmark;\n");
+	printf("8: Check freezing a left-spine tree of a given depth;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-8/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the Binary Search Tree: ");
+			scanf("%d", &i);
+			insertBSTNode(&root, i);
+			break;
+		case 2:
+		case 3:
+			freeFrozen(&frozen);
+			freezeBST(root, &frozen, c == 2 ? EYTZINGER : VEB);
+			printf("Frozen %d keys into %d levels\n", frozen.n, frozen.height);
+			break;
+		case 4:
+			printf("The resulting level-order traversal of the frozen tree is: ");
+			levelOrderFrozen(&frozen);
+			printf("\n");
+			break;
+		case 5:
+			printf("The resulting in-order traversal of the frozen tree is: ");
+			inOrderFrozen(&frozen);
+			printf("\n");
+			break;
+		case 6:
+			printf("Input an integer that you want to search for: ");
+			scanf("%d", &i);
+			if (searchFrozen(&frozen, i))
+				printf("%d is in the frozen tree\n", i);
+			else
+				printf("%d is not in the frozen tree\n", i);
+			break;
+		case 7:
+			printf("Input the number of keys and the number of searches: ");
+			scanf("%d %d", &i, &j);
+			benchmarkFrozen(i, j);
+			break;
+		case 8:
+			printf("Input the depth of the left spine: ");
+			scanf("%d", &i);
+			checkLeftSpine(i);
+			break;
+		case 0:
+			removeAll(&root);
+			freeFrozen(&frozen);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertBSTNode(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertBSTNode(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+// 정렬된 키를 중위 순회 순서대로 BFS 번호 위치에 채움 -> keys[1..n]이 완전 이진 탐색 트리
+static int fillEytzinger(int *keys, int n, const int *sorted, int next, int i)
+{
+	if (i <= n) {
+		next = fillEytzinger(keys, n, sorted, next, 2 * i);
+		keys[i] = sorted[next++];
+		next = fillEytzinger(keys, n, sorted, next, 2 * i + 1);
+	}
+	return next;
+}
+
+// 높이 h인 트리를 위 h/2 레벨과 아래 나머지로 나눔
+// - 아래 트리의 루트 깊이마다 위 트리 크기, 아래 트리 크기, 위 트리 루트 깊이를 기록
+static void splitVEB(FrozenBST *frozen, int depth, int h)
+{
+	int top, bottom;
+
+	if (h <= 1)
+		return;
+	top = h / 2;
+	bottom = h - top;
+	frozen->vebTop[depth + top] = (1 << top) - 1;
+	frozen->vebBottom[depth + top] = (1 << bottom) - 1;
+	frozen->vebRootDepth[depth + top] = depth;
+	splitVEB(frozen, depth, top);
+	splitVEB(frozen, depth + top, bottom);
+}
+
+// BFS 번호 r을 루트로 하는 높이 h 서브트리를 vEB 순서로 out[*pos...]에 기록
+static void layoutVEB(const int *eytzinger, int n, int r, int h, int *out, int *pos)
+{
+	int top, bottom, j;
+
+	if (h == 1) {
+		out[(*pos)++] = r <= n ? eytzinger[r] : 0;	// 완전 트리 밖의 자리는 비워 둠
+		return;
+	}
+	top = h / 2;
+	bottom = h - top;
+	layoutVEB(eytzinger, n, r, top, out, pos);
+	for (j = 0; j < (1 << top); j++)
+		layoutVEB(eytzinger, n, (r << top) | j, bottom, out, pos);
+}
+
+// vEB 배열에서 BFS 번호 i인 노드의 위치: 루트부터 조상들의 위치를 차례로 계산
+static int vebPosition(FrozenBST *frozen, int i)
+{
+	int pos[32];
+	int depth = 0, d, ancestor;
+
+	while ((i >> depth) > 1)
+		depth++;
+	pos[0] = 0;
+	for (d = 1; d <= depth; d++) {
+		ancestor = i >> (depth - d);
+		pos[d] = pos[frozen->vebRootDepth[d]] + frozen->vebTop[d]
+			+ (ancestor & frozen->vebTop[d]) * frozen->vebBottom[d];
+	}
+	return pos[depth];
+}
+
+static int* alignedInts(long long count)
+{
+	// 64바이트 정렬: Eytzinger에서 keys[16k..16k+15]가 한 캐시 라인이 됨
+	int *keys = aligned_alloc(64, (sizeof(int) * count + 63) / 64 * 64);
+
+	if (keys == NULL)
+		exit(0);
+	return keys;
+}
+
+// Builds the frozen copy; the source tree is left untouched
+void freezeBST(BSTNode *root, FrozenBST *frozen, int layout)
+{
+	BSTNode **stack;
+	BSTNode *cur;
+	int *sorted, *eytzinger;
+	int n = 0, top = 0, pos = 0, cap = 64, sortedCap = 64;
+
+	frozen->keys = NULL;
+	frozen->n = 0;
+	frozen->layout = layout;
+	frozen->height = 0;
+
+	// 스택 배열로 한 번만 중위 순회해서 정렬된 키를 모음 (두 배열 모두 꽉 차면 두 배로)
+	stack = malloc(sizeof(BSTNode*) * cap);
+	sorted = malloc(sizeof(int) * sortedCap);
+	if (stack == NULL || sorted == NULL)
+		exit(0);
+	cur = root;
+	while (cur != NULL || top > 0) {
+		while (cur != NULL) {
+			if (top == cap) {
+				cap *= 2;
+				stack = realloc(stack, sizeof(BSTNode*) * cap);
+				if (stack == NULL)
+					exit(0);
+			}
+			stack[top++] = cur;
+			cur = cur->left;
+		}
+		cur = stack[--top];
+		if (n == sortedCap) {
+			sortedCap *= 2;
+			sorted = realloc(sorted, sizeof(int) * sortedCap);
+			if (sorted == NULL)
+				exit(0);
+		}
+		sorted[n++] = cur->item;
+		cur = cur->right;
+	}
+	free(stack);
+	if (n == 0) {
+		free(sorted);
+		return;
+	}
+
+	frozen->n = n;
+	while ((1LL << frozen->height) - 1 < n)
+		frozen->height++;
+	eytzinger = alignedInts(n + 1LL);
+	eytzinger[0] = 0;
+	fillEytzinger(eytzinger, n, sorted, 0, 1);
+	free(sorted);
+
+	if (layout == EYTZINGER) {
+		frozen->keys = eytzinger;
+		return;
+	}
+	splitVEB(frozen, 0, frozen->height);
+	frozen->keys = alignedInts((1LL << frozen->height) - 1);
+	layoutVEB(eytzinger, n, 1, frozen->height, frozen->keys, &pos);
+	free(eytzinger);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 분기 없는 하강: 비교 결과를 더해서 왼쪽(2k)/오른쪽(2k+1) 자식을 고름
+// - 4레벨 아래의 16개 자손 keys[16k..16k+15]는 한 캐시 라인이므로 미리 prefetch
+// - 끝나면 k의 하위 비트에 "오른쪽으로 간 횟수+1"만큼의 1과 0이 남으므로
+//   그만큼 밀어서 마지막으로 왼쪽으로 갔던 노드(= value 이상인 첫 키)를 복원
+static int searchEytzinger(const int *keys, int n, int value, int prefetch)
+{
+	unsigned k = 1;
+
+	while (k <= (unsigned)n) {
+		if (prefetch)
+			__builtin_prefetch(keys + 16 * k);
+		k = 2 * k + (keys[k] < value);
+	}
+	k >>= __builtin_ffs(~k);
+	return k != 0 && keys[k] == value;
+}
+
+// vEB 배열에서는 BFS 번호 i와 함께 지나온 깊이별 위치 pos[]를 유지
+static int searchVEB(FrozenBST *frozen, int value)
+{
+	int pos[32];
+	unsigned i = 1;
+	int d, key;
+
+	pos[0] = 0;
+	for (d = 0; d < frozen->height && i <= (unsigned)frozen->n; d++) {
+		if (d > 0)
+			pos[d] = pos[frozen->vebRootDepth[d]] + frozen->vebTop[d]
+				+ (i & frozen->vebTop[d]) * frozen->vebBottom[d];
+		key = frozen->keys[pos[d]];
+		if (key == value)
+			return 1;
+		i = 2 * i + (key < value);
+	}
+	return 0;
+}
+
+int searchFrozen(FrozenBST *frozen, int value)
+{
+	if (frozen->n == 0)
+		return 0;
+	if (frozen->layout == EYTZINGER)
+		return searchEytzinger(frozen->keys, frozen->n, value, 1);
+	return searchVEB(frozen, value);
+}
+
+static int keyAt(FrozenBST *frozen, int i)
+{
+	if (frozen->layout == EYTZINGER)
+		return frozen->keys[i];
+	return frozen->keys[vebPosition(frozen, i)];
+}
+
+// BFS 번호 순서가 곧 레벨 순서라서 큐가 필요 없음
+void levelOrderFrozen(FrozenBST *frozen)
+{
+	int i;
+
+	for (i = 1; i <= frozen->n; i++)
+		printf("%d ", keyAt(frozen, i));
+}
+
+// 스택 없이 번호만으로 중위 순회
+// - 오른쪽 자식이 있으면 그 서브트리의 가장 왼쪽으로
+// - 없으면 왼쪽 자식(짝수 번호)에서 올라올 때까지 부모로 이동
+void inOrderFrozen(FrozenBST *frozen)
+{
+	long long i = 1, n = frozen->n;
+
+	if (n == 0)
+		return;
+	while (2 * i <= n)
+		i = 2 * i;
+	while (i != 0) {
+		printf("%d ", keyAt(frozen, (int)i));
+		if (2 * i + 1 <= n) {
+			i = 2 * i + 1;
+			while (2 * i <= n)
+				i = 2 * i;
+		}
+		else {
+			while (i & 1)
+				i >>= 1;
+			i >>= 1;
+		}
+	}
+}
+
+void freeFrozen(FrozenBST *frozen)
+{
+	free(frozen->keys);
+	frozen->keys = NULL;
+	frozen->n = 0;
+	frozen->height = 0;
+}
+
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static BSTNode* searchBSTNode(BSTNode *root, int value)
+{
+	while (root != NULL && root->item != value)
+		root = value < root->item ? root->left : root->right;
+	return root;
+}
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// murmur3의 fmix32 (32비트 전단사) - 서로 다른 i는 서로 다른 무작위 키
+static int keyFor(unsigned i)
+{
+	i ^= i >> 16;
+	i *= 0x85ebca6bu;
+	i ^= i >> 13;
+	i *= 0xc2b2ae35u;
+	i ^= i >> 16;
+	return (int)i;
+}
+
+// 무작위 순서로 넣은 n개 BST를 얼린 뒤 같은 조회(절반은 없는 키)를 네 가지 방식으로 실행
+void benchmarkFrozen(int n, int queries)
+{
+	static const char *names[] = { "pointer BST         ", "Eytzinger           ",
+		"Eytzinger + prefetch", "van Emde Boas       " };
+	BSTNode *root = NULL;
+	FrozenBST eyt, veb;
+	int *probes;
+	long long found[4];
+	double seconds[4];
+	clock_t start;
+	int i, method;
+
+	if (n <= 0 || queries <= 0)
+		return;
+	probes = malloc(sizeof(int) * queries);
+	if (probes == NULL)
+		return;
+	for (i = 0; i < n; i++)
+		insertBSTNode(&root, keyFor(i));
+	for (i = 0; i < queries; i++)
+		probes[i] = keyFor((unsigned)rand() % (2u * n));
+
+	start = clock();
+	freezeBST(root, &eyt, EYTZINGER);
+	printf("n = %d, %d searches: freeze %.3f s, BST %.1f MB -> array %.1f MB\n", n, queries,
+		elapsed(start), (double)n * sizeof(BSTNode) / 1e6, (double)n * sizeof(int) / 1e6);
+	freezeBST(root, &veb, VEB);
+
+	for (method = 0; method < 4; method++) {
+		found[method] = 0;
+		start = clock();
+		for (i = 0; i < queries; i++) {
+			if (method == 0)
+				found[method] += searchBSTNode(root, probes[i]) != NULL;
+			else if (method == 1)
+				found[method] += searchEytzinger(eyt.keys, eyt.n, probes[i], 0);
+			else if (method == 2)
+				found[method] += searchEytzinger(eyt.keys, eyt.n, probes[i], 1);
+			else
+				found[method] += searchVEB(&veb, probes[i]);
+		}
+		seconds[method] = elapsed(start);
+		printf("  %s %8.3f s %8.1f ns/search  %5.2fx%s\n", names[method], seconds[method],
+			seconds[method] * 1e9 / queries, seconds[0] / seconds[method],
+			found[method] == found[0] ? "" : " (RESULTS DIFFER)");
+	}
+
+	freeFrozen(&eyt);
+	freeFrozen(&veb);
+	removeAll(&root);
+	free(probes);
+}
+
+// 키를 큰 것부터 넣어서 깊이 depth의 왼쪽 사슬을 만든 뒤 두 방식으로 얼려서 확인
+// - 중위 순서가 0, 1, ..., depth-1이고 모든 키를 찾고 없는 키는 못 찾아야 함
+void checkLeftSpine(int depth)
+{
+	BSTNode *root = NULL, **link = &root;
+	FrozenBST frozen;
+	long long i, prev;
+	int layout, ok = 1;
+
+	if (depth <= 0)
+		return;
+	// 재귀 insertBSTNode로 넣으면 사슬 길이만큼 재귀가 깊어지므로 직접 연결
+	for (i = depth - 1; i >= 0; i--) {
+		*link = malloc(sizeof(BSTNode));
+		if (*link == NULL)
+			exit(0);
+		(*link)->item = (int)i;
+		(*link)->left = NULL;
+		(*link)->right = NULL;
+		link = &(*link)->left;
+	}
+	for (layout = EYTZINGER; layout <= VEB; layout++) {
+		freezeBST(root, &frozen, layout);
+		if (frozen.n != depth)
+			ok = 0;
+		// inOrderFrozen과 같은 번호 이동으로 정렬 순서 확인
+		prev = -1;
+		for (i = 1; 2 * i <= frozen.n; i = 2 * i)
+			;
+		while (i != 0 && ok) {
+			if (keyAt(&frozen, (int)i) != prev + 1)
+				ok = 0;
+			prev = keyAt(&frozen, (int)i);
+			if (2 * i + 1 <= frozen.n) {
+				i = 2 * i + 1;
+				while (2 * i <= frozen.n)
+					i = 2 * i;
+			}
+			else {
+				while (i & 1)
+					i >>= 1;
+				i >>= 1;
+			}
+		}
+		for (i = -1; i <= depth && ok; i++) {
+			if (searchFrozen(&frozen, (int)i) != (i >= 0 && i < depth))
+				ok = 0;
+		}
+		freeFrozen(&frozen);
+	}
+	printf("Left spine of depth %d: %s\n", depth, ok ? "frozen correctly in both layouts" : "(CHECK FAILED)");
+	removeAll(&root);
+}
@@ -0,0 +1,583 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: Morris (threaded) in-order, pre-order and post-order traversals that
+		 need no stack and no allocation and leave the tree unchanged, with a
+		 benchmark against the StackNode-based traversals on deep trees */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;
+
+typedef struct _QueueNode {
+	BSTNode *data;
+	struct _QueueNode *nextPtr;
+}QueueNode;
+
+typedef struct _queue
+{
+	QueueNode *head;
+	QueueNode *tail;
+}Queue;
+
+typedef struct _stackNode{
+	BSTNode *data;
+	struct _stackNode *next;
+}StackNode;
+
+typedef struct _stack
+{
+	StackNode *top;
+}Stack;
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value);
+void inOrderMorris(BSTNode *root);
+void preOrderMorris(BSTNode *root);
+void postOrderMorris(BSTNode *root);
+void levelOrderTraversal(BSTNode *root);
+
+BSTNode* dequeue(QueueNode **head, QueueNode **tail);
+void enqueue(QueueNode **head, QueueNode **tail, BSTNode *node);
+int isEmpty(QueueNode *head);
+void push(Stack *stack, BSTNode *node);
+BSTNode* pop(Stack *s);
+BSTNode* peek(Stack *s);
+int isEmptyStack(Stack *s);
+void removeAll(BSTNode **node);
+
+void benchmarkMorris(int n);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i;
+	c = 1;
+
+	//Initialize the Binary Search Tree as an empty Binary Search Tree
+	BSTNode *root;
+	root = NULL;
+
+	printf("1: Insert an integer into the binary search tree;\n");
+	printf("2: Print the in-order traversal (Morris);\n");
+	printf("3: Print the pre-order traversal (Morris);\n");
+	printf("4: Print the post-order traversal (Morris);\n");
+	printf("5: Print the level-order traversal;\n");
+	printf("6: Run the Morris vs stack-based traversal benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-6/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the Binary Search Tree: ");
+			scanf("%d", &i);
+			insertBSTNode(&root, i);
+			break;
+		case 2:
+			printf("The resulting in-order traversal of the binary search tree is: ");
+			inOrderMorris(root);
+			printf("\n");
+			break;
+		case 3:
+			printf("The resulting pre-order traversal of the binary search tree is: ");
+			preOrderMorris(root);
+			printf("\n");
+			break;
+		case 4:
+			printf("The resulting post-order traversal of the binary search tree is: ");
+			postOrderMorris(root);
+			printf("\n");
+			break;
+		case 5:
+			printf("The resulting level-order traversal of the binary search tree is: ");
+			levelOrderTraversal(root);
+			printf("\n");
+			break;
+		case 6:
+			printf("Input the number of nodes: ");
+			scanf("%d", &i);
+			benchmarkMorris(i);
+			break;
+		case 0:
+			removeAll(&root);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertBSTNode(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertBSTNode(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+// Morris traversal: instead of a stack, the right pointer of a node's in-order
+// predecessor (always NULL in a BST) temporarily points back to the node.
+// The thread is created on the first visit and removed on the second, so the
+// tree is back to its original shape when the walk ends.
+
+// cur의 왼쪽 서브트리에서 가장 오른쪽 노드 (스레드가 이미 있으면 거기서 멈춤)
+static BSTNode* predecessor(BSTNode *cur)
+{
+	BSTNode *pre = cur->left;
+
+	while (pre->right != NULL && pre->right != cur)
+		pre = pre->right;
+	return pre;
+}
+
+static void morrisInOrder(BSTNode *cur, void (*visit)(BSTNode *))
+{
+	BSTNode *pre;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			visit(cur);
+			cur = cur->right;
+			continue;
+		}
+		pre = predecessor(cur);
+		if (pre->right == NULL) {
+			pre->right = cur;		// 처음 도착: 돌아올 길을 만들고 왼쪽으로
+			cur = cur->left;
+		}
+		else {
+			pre->right = NULL;		// 스레드로 돌아옴: 왼쪽이 끝났으므로 방문
+			visit(cur);
+			cur = cur->right;
+		}
+	}
+}
+
+// 중위와 같고 방문 시점만 스레드를 만들 때로 바뀜
+static void morrisPreOrder(BSTNode *cur, void (*visit)(BSTNode *))
+{
+	BSTNode *pre;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			visit(cur);
+			cur = cur->right;
+			continue;
+		}
+		pre = predecessor(cur);
+		if (pre->right == NULL) {
+			visit(cur);
+			pre->right = cur;
+			cur = cur->left;
+		}
+		else {
+			pre->right = NULL;
+			cur = cur->right;
+		}
+	}
+}
+
+// right 포인터로 이어진 from..to 경로를 뒤집음
+static void reverseRightPath(BSTNode *from, BSTNode *to)
+{
+	BSTNode *prev = NULL, *cur = from, *next;
+
+	while (prev != to) {
+		next = cur->right;
+		cur->right = prev;
+		prev = cur;
+		cur = next;
+	}
+}
+
+// 뒤집은 경로를 to부터 방문한 뒤 다시 원래대로 뒤집음
+static void visitReversed(BSTNode *from, BSTNode *to, void (*visit)(BSTNode *))
+{
+	BSTNode *cur;
+
+	reverseRightPath(from, to);
+	for (cur = to; ; cur = cur->right) {
+		visit(cur);
+		if (cur == from)
+			break;
+	}
+	reverseRightPath(to, from);
+}
+
+// 후위: 스레드로 돌아올 때마다 cur->left부터 pre까지의 오른쪽 경로를 거꾸로 방문
+// - 루트를 왼쪽 자식으로 갖는 dummy 노드(지역 변수)로 마지막 오른쪽 경로까지 처리
+static void morrisPostOrder(BSTNode *root, void (*visit)(BSTNode *))
+{
+	BSTNode dummy, *cur = &dummy, *pre;
+
+	dummy.item = 0;
+	dummy.left = root;
+	dummy.right = NULL;
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			cur = cur->right;
+			continue;
+		}
+		pre = predecessor(cur);
+		if (pre->right == NULL) {
+			pre->right = cur;
+			cur = cur->left;
+		}
+		else {
+			pre->right = NULL;
+			visitReversed(cur->left, pre, visit);
+			cur = cur->right;
+		}
+	}
+}
+
+static void printNode(BSTNode *node)
+{
+	printf("%d ", node->item);
+}
+
+void inOrderMorris(BSTNode *root)
+{
+	morrisInOrder(root, printNode);
+}
+
+void preOrderMorris(BSTNode *root)
+{
+	morrisPreOrder(root, printNode);
+}
+
+void postOrderMorris(BSTNode *root)
+{
+	morrisPostOrder(root, printNode);
+}
+
+void levelOrderTraversal(BSTNode* root)
+{
+	if (root == NULL)
+		return;
+	Queue *queue = (Queue*)malloc(sizeof(Queue));
+	queue->head = NULL;
+	queue->tail = NULL;
+	enqueue(&queue->head, &queue->tail, root);
+
+	while (!isEmpty(queue->head)) {
+		BSTNode *node = dequeue(&queue->head, &queue->tail);
+		printf("%d ", node->item);
+		if (node->left)
+			enqueue(&queue->head, &queue->tail, node->left);
+		if (node->right)
+			enqueue(&queue->head, &queue->tail, node->right);
+	}
+	free(queue);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// enqueue node
+void enqueue(QueueNode **headPtr, QueueNode **tailPtr, BSTNode *node)
+{
+	// dynamically allocate memory
+	QueueNode *newPtr = malloc(sizeof(QueueNode));
+
+	// if newPtr does not equal NULL
+	if (newPtr != NULL) {
+		newPtr->data = node;
+		newPtr->nextPtr = NULL;
+
+		// if queue is empty, insert at head
+		if (isEmpty(*headPtr)) {
+			*headPtr = newPtr;
+		}
+		else { // insert at tail
+			(*tailPtr)->nextPtr = newPtr;
+		}
+
+		*tailPtr = newPtr;
+	}
+	else {
+		printf("Node not inserted");
+	}
+}
+
+BSTNode* dequeue(QueueNode **headPtr, QueueNode **tailPtr)
+{
+	BSTNode *node = (*headPtr)->data;
+	QueueNode *tempPtr = *headPtr;
+	*headPtr = (*headPtr)->nextPtr;
+
+	if (*headPtr == NULL) {
+		*tailPtr = NULL;
+	}
+
+	free(tempPtr);
+
+	return node;
+}
+
+int isEmpty(QueueNode *head)
+{
+	return head == NULL;
+}
+
+void push(Stack *stack, BSTNode * node)
+{
+	StackNode *temp;
+
+	temp = malloc(sizeof(StackNode));
+
+	if (temp == NULL)
+		return;
+	temp->data = node;
+	temp->next = stack->top;
+	stack->top = temp;
+}
+
+BSTNode * pop(Stack * s)
+{
+	StackNode *t;
+	BSTNode * ptr;
+	ptr = NULL;
+
+	t = s->top;
+	if (t != NULL)
+	{
+		ptr = t->data;
+		s->top = t->next;
+		free(t);
+	}
+
+	return ptr;
+}
+
+BSTNode * peek(Stack * s)
+{
+	StackNode *temp;
+	temp = s->top;
+	if (temp != NULL)
+		return temp->data;
+	else
+		return NULL;
+}
+
+int isEmptyStack(Stack *s)
+{
+	if (s->top == NULL)
+		return 1;
+	else
+		return 0;
+}
+
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// StackNode-based baselines as in Q2-Q5, minus the node freeing in Q2-Q4
+
+static void stackInOrder(BSTNode *root, void (*visit)(BSTNode *))
+{
+	Stack s = { NULL };
+	BSTNode *cur = root;
+
+	while (cur != NULL || !isEmptyStack(&s)) {
+		while (cur != NULL) {
+			push(&s, cur);
+			cur = cur->left;
+		}
+		cur = pop(&s);
+		visit(cur);
+		cur = cur->right;
+	}
+}
+
+static void stackPreOrder(BSTNode *root, void (*visit)(BSTNode *))
+{
+	Stack s = { NULL };
+	BSTNode *node;
+
+	if (root == NULL)
+		return;
+	push(&s, root);
+	while (!isEmptyStack(&s)) {
+		node = pop(&s);
+		visit(node);
+		if (node->right)
+			push(&s, node->right);
+		if (node->left)
+			push(&s, node->left);
+	}
+}
+
+static void stackPostOrderS2(BSTNode *root, void (*visit)(BSTNode *))
+{
+	Stack s1 = { NULL }, s2 = { NULL };
+	BSTNode *node;
+
+	if (root == NULL)
+		return;
+	push(&s1, root);
+	while (!isEmptyStack(&s1)) {
+		node = pop(&s1);
+		push(&s2, node);
+		if (node->left)
+			push(&s1, node->left);
+		if (node->right)
+			push(&s1, node->right);
+	}
+	while (!isEmptyStack(&s2))
+		visit(pop(&s2));
+}
+
+static unsigned long long checksum;
+static unsigned long long position;
+
+// 순서가 다르면 값이 달라지도록 위치를 곱해서 누적
+static void sumNode(BSTNode *node)
+{
+	checksum += ++position * (unsigned)node->item;
+}
+
+// 모양별 트리 생성 (정렬 삽입과 같은 한쪽 사슬은 재귀 삽입 대신 직접 연결)
+// shape 0: 무작위, 1: 왼쪽 사슬, 2: 오른쪽 사슬, 3: 지그재그 사슬
+static BSTNode* buildTree(int n, int shape)
+{
+	BSTNode *root = NULL, *node, *prev = NULL, **link;
+	int i, key, lo = 0, hi = n - 1;
+
+	for (i = 0; i < n; i++) {
+		node = malloc(sizeof(BSTNode));
+		if (node == NULL)
+			exit(0);
+		node->left = NULL;
+		node->right = NULL;
+		if (shape == 0) {
+			key = (int)(((long long)i * 2654435761u) % 4294967291u);
+			node->item = key;
+			link = &root;
+			while (*link != NULL)
+				link = key < (*link)->item ? &((*link)->left) : &((*link)->right);
+			*link = node;
+			continue;
+		}
+		if (shape == 3)
+			key = i % 2 == 0 ? lo++ : hi--;
+		else
+			key = shape == 1 ? n - 1 - i : i;
+		node->item = key;
+		if (prev == NULL)
+			root = node;
+		else if (key < prev->item)
+			prev->left = node;
+		else
+			prev->right = node;
+		prev = node;
+	}
+	return root;
+}
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// 각 모양의 트리에서 세 가지 순회를 Morris / 스택 방식으로 실행하고 결과 체크섬 비교
+void benchmarkMorris(int n)
+{
+	static const char *shapes[] = { "random", "left chain", "right chain", "zigzag chain" };
+	static const char *orders[] = { "in-order  ", "pre-order ", "post-order" };
+	BSTNode *root;
+	clock_t start;
+	double morris, stack;
+	unsigned long long morrisSum;
+	int shape, order;
+
+	if (n <= 0)
+		return;
+	printf("n = %d:\n", n);
+	for (shape = 0; shape < 4; shape++) {
+		root = buildTree(n, shape);
+		for (order = 0; order < 3; order++) {
+			checksum = position = 0;
+			start = clock();
+			if (order == 0)
+				morrisInOrder(root, sumNode);
+			else if (order == 1)
+				morrisPreOrder(root, sumNode);
+			else
+				morrisPostOrder(root, sumNode);
+			morris = elapsed(start);
+			morrisSum = checksum;
+
+			checksum = position = 0;
+			start = clock();
+			if (order == 0)
+				stackInOrder(root, sumNode);
+			else if (order == 1)
+				stackPreOrder(root, sumNode);
+			else
+				stackPostOrderS2(root, sumNode);
+			stack = elapsed(start);
+
+			printf("  %-12s %s: Morris %8.1f ns/node, stack %8.1f ns/node%s\n", shapes[shape],
+				orders[order], morris * 1e9 / n, stack * 1e9 / n,
+				morrisSum == checksum ? "" : " (RESULTS DIFFER)");
+		}
+		removeAll(&root);
+	}
+}
@@ -0,0 +1,594 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: Order-statistic BST - the AVL insertBSTNode() / removeNodeFromTree()
+		 also maintain subtree sizes, so select(k), rank(x) and
+		 countRange(lo, hi) run in O(log n) instead of an in-order walk */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+	int height;		// nodes on the longest path down to a leaf (leaf = 1)
+	int size;		// nodes in this subtree, including this one
+} BSTNode;
+
+typedef struct _QueueNode {
+	BSTNode *data;
+	struct _QueueNode *nextPtr;
+}QueueNode;
+
+typedef struct _queue
+{
+	QueueNode *head;
+	QueueNode *tail;
+}Queue;
+
+typedef struct _stackNode{
+	BSTNode *data;
+	struct _stackNode *next;
+}StackNode;
+
+typedef struct _stack
+{
+	StackNode *top;
+}Stack;
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value);
+BSTNode* removeNodeFromTree(BSTNode *root, int value);
+BSTNode* selectBSTNode(BSTNode *root, int k);
+int rankBST(BSTNode *root, int value);
+int countRange(BSTNode *root, int lo, int hi);
+int checkOrderStat(BSTNode *node);
+
+void levelOrderTraversal(BSTNode *node);
+
+BSTNode* dequeue(QueueNode **head, QueueNode **tail);
+void enqueue(QueueNode **head, QueueNode **tail, BSTNode *node);
+int isEmpty(QueueNode *head);
+void push(Stack *stack, BSTNode *node);
+BSTNode* pop(Stack *s);
+int isEmptyStack(Stack *s);
+void removeAll(BSTNode **node);
+
+void benchmarkOrderStat(int n, int queries);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j;
+	BSTNode *node;
+	c = 1;
+
+	//Initialize the Binary Search Tree as an empty Binary Search Tree
+	BSTNode *root;
+	root = NULL;
+
+	printf("1: Insert an integer into the order-statistic tree;\n");
+	printf("2: Remove an integer from the order-statistic tree;\n");
+	printf("3: Print the k-th smallest integer (select);\n");
+	printf("4: Print how many integers are smaller than x (rank);\n");
+	printf("5: Print how many integers are in a range [lo, hi];\n");
+	printf("6: Print the level-order traversal of the tree;\n");
+	printf("7: Check the balance and the subtree sizes;\n");
+	printf("8: Run the order-statistic vs in-order walk benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-8/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the tree: ");
+			scanf("%d", &i);
+			insertBSTNode(&root, i);
+			break;
+		case 2:
+			printf("Input an integer that you want to remove from the tree: ");
+			scanf("%d", &i);
+			root = removeNodeFromTree(root, i);
+			break;
+		case 3:
+			printf("Input k (1 = smallest): ");
+			scanf("%d", &i);
+			node = selectBSTNode(root, i);
+			if (node == NULL)
+				printf("There is no %d-th smallest integer\n", i);
+			else
+				printf("The %d-th smallest integer is %d\n", i, node->item);
+			break;
+		case 4:
+			printf("Input x: ");
+			scanf("%d", &i);
+			printf("%d integers are smaller than %d\n", rankBST(root, i), i);
+			break;
+		case 5:
+			printf("Input the range lo and hi: ");
+			scanf("%d %d", &i, &j);
+			printf("%d integers are in [%d, %d]\n", countRange(root, i, j), i, j);
+			break;
+		case 6:
+			printf("The resulting level-order traversal of the tree is: ");
+			levelOrderTraversal(root);
+			printf("\n");
+			break;
+		case 7:
+			i = checkOrderStat(root);
+			if (i == -1)
+				printf("The tree is NOT a valid order-statistic tree\n");
+			else
+				printf("The tree is valid with %d nodes\n", i);
+			break;
+		case 8:
+			printf("Input the number of keys and the number of queries: ");
+			scanf("%d %d", &i, &j);
+			benchmarkOrderStat(i, j);
+			break;
+		case 0:
+			removeAll(&root);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static int height(BSTNode *node)
+{
+	return node == NULL ? 0 : node->height;
+}
+
+static int size(BSTNode *node)
+{
+	return node == NULL ? 0 : node->size;
+}
+
+// 자식이 바뀐 노드의 높이와 크기를 다시 계산
+static void update(BSTNode *node)
+{
+	int lh = height(node->left), rh = height(node->right);
+	node->height = 1 + (lh > rh ? lh : rh);
+	node->size = 1 + size(node->left) + size(node->right);
+}
+
+static BSTNode* rotateRight(BSTNode *y)
+{
+	BSTNode *x = y->left;
+
+	y->left = x->right;
+	x->right = y;
+	update(y);
+	update(x);
+	return x;
+}
+
+static BSTNode* rotateLeft(BSTNode *x)
+{
+	BSTNode *y = x->right;
+
+	x->right = y->left;
+	y->left = x;
+	update(x);
+	update(y);
+	return y;
+}
+
+// AVL_F_BST.c와 같은 재균형 - update()가 크기도 함께 맞춰 줌
+static BSTNode* rebalance(BSTNode *node)
+{
+	int balance;
+
+	update(node);
+	balance = height(node->left) - height(node->right);
+	if (balance > 1) {
+		if (height(node->left->left) < height(node->left->right))
+			node->left = rotateLeft(node->left);
+		return rotateRight(node);
+	}
+	if (balance < -1) {
+		if (height(node->right->right) < height(node->right->left))
+			node->right = rotateRight(node->right);
+		return rotateLeft(node);
+	}
+	return node;
+}
+
+// Same contract as the plain insertBSTNode(): duplicates are ignored
+void insertBSTNode(BSTNode **node, int value)
+{
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+		if (*node == NULL)
+			exit(0);
+		(*node)->item = value;
+		(*node)->left = NULL;
+		(*node)->right = NULL;
+		(*node)->height = 1;
+		(*node)->size = 1;
+		return;
+	}
+
+	if (value < (*node)->item)
+		insertBSTNode(&((*node)->left), value);
+	else if (value > (*node)->item)
+		insertBSTNode(&((*node)->right), value);
+	else
+		return;
+	*node = rebalance(*node);
+}
+
+// Q5의 removeNodeFromTree와 같은 방식, 되돌아오는 길에서 rebalance가 크기도 갱신
+BSTNode* removeNodeFromTree(BSTNode *root, int value)
+{
+	BSTNode *temp, *successor;
+
+	if (root == NULL)
+		return NULL;
+
+	if (value < root->item)
+		root->left = removeNodeFromTree(root->left, value);
+	else if (value > root->item)
+		root->right = removeNodeFromTree(root->right, value);
+	else {
+		if (root->left == NULL || root->right == NULL) {
+			temp = root->left != NULL ? root->left : root->right;
+			free(root);
+			return temp;
+		}
+		successor = root->right;
+		while (successor->left != NULL)
+			successor = successor->left;
+		root->item = successor->item;
+		root->right = removeNodeFromTree(root->right, successor->item);
+	}
+	return rebalance(root);
+}
+
+// k번째(1부터) 작은 노드: 왼쪽 서브트리 크기와 비교해서 한쪽으로만 내려감
+BSTNode* selectBSTNode(BSTNode *root, int k)
+{
+	int leftSize;
+
+	while (root != NULL) {
+		leftSize = size(root->left);
+		if (k <= leftSize) {
+			root = root->left;
+		}
+		else if (k == leftSize + 1) {
+			return root;
+		}
+		else {
+			k -= leftSize + 1;
+			root = root->right;
+		}
+	}
+	return NULL;
+}
+
+// value보다 작은(inclusive면 작거나 같은) 키의 개수
+// - 오른쪽으로 내려갈 때마다 왼쪽 서브트리와 현재 노드를 한꺼번에 셈
+static int countBelow(BSTNode *root, int value, int inclusive)
+{
+	int count = 0;
+
+	while (root != NULL) {
+		if (root->item < value || (inclusive && root->item == value)) {
+			count += size(root->left) + 1;
+			root = root->right;
+		}
+		else {
+			root = root->left;
+		}
+	}
+	return count;
+}
+
+// Number of keys smaller than value
+int rankBST(BSTNode *root, int value)
+{
+	return countBelow(root, value, 0);
+}
+
+// Number of keys in [lo, hi]
+int countRange(BSTNode *root, int lo, int hi)
+{
+	if (lo > hi)
+		return 0;
+	return countBelow(root, hi, 1) - countBelow(root, lo, 0);
+}
+
+// 순서, 균형, 저장된 높이/크기를 모두 검사 - 정상이면 노드 수, 아니면 -1
+static int checkRange(BSTNode *node, long long lo, long long hi)
+{
+	int ls, rs;
+
+	if (node == NULL)
+		return 0;
+	if (node->item <= lo || node->item >= hi)
+		return -1;
+	ls = checkRange(node->left, lo, node->item);
+	rs = checkRange(node->right, node->item, hi);
+	if (ls == -1 || rs == -1 || height(node->left) - height(node->right) > 1
+		|| height(node->right) - height(node->left) > 1)
+		return -1;
+	if (node->height != 1 + (height(node->left) > height(node->right) ? height(node->left) : height(node->right)))
+		return -1;
+	if (node->size != ls + rs + 1)
+		return -1;
+	return node->size;
+}
+
+int checkOrderStat(BSTNode *node)
+{
+	return checkRange(node, -2147483649LL, 2147483648LL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void levelOrderTraversal(BSTNode* root)
+{
+	if (root == NULL)
+		return;
+	Queue *queue = (Queue*)malloc(sizeof(Queue));
+	queue->head = NULL;
+	queue->tail = NULL;
+	enqueue(&queue->head, &queue->tail, root);
+
+	while (!isEmpty(queue->head)) {
+		BSTNode *node = dequeue(&queue->head, &queue->tail);
+		printf("%d ", node->item);
+		if (node->left)
+			enqueue(&queue->head, &queue->tail, node->left);
+		if (node->right)
+			enqueue(&queue->head, &queue->tail, node->right);
+	}
+	free(queue);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// enqueue node
+void enqueue(QueueNode **headPtr, QueueNode **tailPtr, BSTNode *node)
+{
+	// dynamically allocate memory
+	QueueNode *newPtr = malloc(sizeof(QueueNode));
+
+	// if newPtr does not equal NULL
+	if (newPtr != NULL) {
+		newPtr->data = node;
+		newPtr->nextPtr = NULL;
+
+		// if queue is empty, insert at head
+		if (isEmpty(*headPtr)) {
+			*headPtr = newPtr;
+		}
+		else { // insert at tail
+			(*tailPtr)->nextPtr = newPtr;
+		}
+
+		*tailPtr = newPtr;
+	}
+	else {
+		printf("Node not inserted");
+	}
+}
+
+BSTNode* dequeue(QueueNode **headPtr, QueueNode **tailPtr)
+{
+	BSTNode *node = (*headPtr)->data;
+	QueueNode *tempPtr = *headPtr;
+	*headPtr = (*headPtr)->nextPtr;
+
+	if (*headPtr == NULL) {
+		*tailPtr = NULL;
+	}
+
+	free(tempPtr);
+
+	return node;
+}
+
+int isEmpty(QueueNode *head)
+{
+	return head == NULL;
+}
+
+void push(Stack *stack, BSTNode * node)
+{
+	StackNode *temp;
+
+	temp = malloc(sizeof(StackNode));
+
+	if (temp == NULL)
+		return;
+	temp->data = node;
+	temp->next = stack->top;
+	stack->top = temp;
+}
+
+BSTNode * pop(Stack * s)
+{
+	StackNode *t;
+	BSTNode * ptr;
+	ptr = NULL;
+
+	t = s->top;
+	if (t != NULL)
+	{
+		ptr = t->data;
+		s->top = t->next;
+		free(t);
+	}
+
+	return ptr;
+}
+
+int isEmptyStack(Stack *s)
+{
+	if (s->top == NULL)
+		return 1;
+	else
+		return 0;
+}
+
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Linear baselines: the stack-based in-order walk used today, stopping as
+// soon as the answer is known
+
+static BSTNode* linearSelect(BSTNode *root, int k)
+{
+	Stack s = { NULL };
+	BSTNode *cur = root;
+
+	while (cur != NULL || !isEmptyStack(&s)) {
+		while (cur != NULL) {
+			push(&s, cur);
+			cur = cur->left;
+		}
+		cur = pop(&s);
+		if (--k == 0) {
+			while (!isEmptyStack(&s))
+				pop(&s);
+			return cur;
+		}
+		cur = cur->right;
+	}
+	return NULL;
+}
+
+static int linearCountRange(BSTNode *root, int lo, int hi)
+{
+	Stack s = { NULL };
+	BSTNode *cur = root;
+	int count = 0;
+
+	while (cur != NULL || !isEmptyStack(&s)) {
+		while (cur != NULL) {
+			push(&s, cur);
+			cur = cur->left;
+		}
+		cur = pop(&s);
+		if (cur->item > hi) {
+			while (!isEmptyStack(&s))
+				pop(&s);
+			break;
+		}
+		count += cur->item >= lo;
+		cur = cur->right;
+	}
+	return count;
+}
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// 키 0, 2, ..., 2(n-1)을 넣고 같은 무작위 질의를 두 방식으로 실행
+// - 선형 방식은 질의당 O(n)이라 전체 작업량이 약 10^8 노드가 되도록 질의 수를 줄임
+void benchmarkOrderStat(int n, int queries)
+{
+	BSTNode *root = NULL, *node;
+	clock_t start;
+	double fast, slow;
+	long long sumFast = 0, sumSlow = 0;
+	int *ks, *los, *his;
+	int i, linearQueries;
+
+	if (n <= 0 || queries <= 0)
+		return;
+	ks = malloc(sizeof(int) * queries);
+	los = malloc(sizeof(int) * queries);
+	his = malloc(sizeof(int) * queries);
+	if (ks == NULL || los == NULL || his == NULL) {
+		free(ks);
+		free(los);
+		free(his);
+		return;
+	}
+	for (i = 0; i < n; i++)
+		insertBSTNode(&root, 2 * i);
+	for (i = 0; i < queries; i++) {
+		ks[i] = 1 + rand() % n;
+		los[i] = rand() % (2 * n);
+		his[i] = los[i] + rand() % (2 * n - los[i]);
+	}
+	linearQueries = (int)(100000000LL / n);
+	if (linearQueries < 1)
+		linearQueries = 1;
+	if (linearQueries > queries)
+		linearQueries = queries;
+	printf("n = %d, %d queries (%d for the linear walk):\n", n, queries, linearQueries);
+
+	start = clock();
+	for (i = 0; i < queries; i++) {
+		node = selectBSTNode(root, ks[i]);
+		sumFast += i < linearQueries ? node->item : 0;
+	}
+	fast = elapsed(start) / queries;
+	start = clock();
+	for (i = 0; i < linearQueries; i++)
+		sumSlow += linearSelect(root, ks[i])->item;
+	slow = elapsed(start) / linearQueries;
+	printf("  select:     %10.1f ns vs %12.1f ns per query (%.0fx)%s\n", fast * 1e9, slow * 1e9,
+		slow / fast, sumFast == sumSlow ? "" : " (RESULTS DIFFER)");
+
+	sumFast = sumSlow = 0;
+	start = clock();
+	for (i = 0; i < queries; i++) {
+		int count = countRange(root, los[i], his[i]);
+		sumFast += i < linearQueries ? count : 0;
+	}
+	fast = elapsed(start) / queries;
+	start = clock();
+	for (i = 0; i < linearQueries; i++)
+		sumSlow += linearCountRange(root, los[i], his[i]);
+	slow = elapsed(start) / linearQueries;
+	printf("  countRange: %10.1f ns vs %12.1f ns per query (%.0fx)%s\n", fast * 1e9, slow * 1e9,
+		slow / fast, sumFast == sumSlow ? "" : " (RESULTS DIFFER)");
+
+	removeAll(&root);
+	free(ks);
+	free(los);
+	free(his);
+}
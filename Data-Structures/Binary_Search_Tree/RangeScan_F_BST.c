@@ -0,0 +1,389 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: Range queries on a BST that skip subtrees outside [lo, hi], visiting
+		 O(h + k) nodes instead of the whole tree, and a resumable in-order
+		 range iterator with no recursion or allocation per step */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define ITER_INLINE 48		// stack slots kept inside the iterator itself
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;
+
+// The stack holds the nodes whose key is still to be produced, smallest on
+// top. It lives in inlineStack until the tree is deeper than ITER_INLINE and
+// only then moves to a heap buffer that doubles, so a step never allocates
+// on a balanced tree. Modifying the tree invalidates the iterator.
+typedef struct _bstiterator{
+	BSTNode **stack;
+	int top;
+	int capacity;
+	int hi;
+	BSTNode *inlineStack[ITER_INLINE];
+} BSTIterator;
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value);
+int collectRange(BSTNode *root, int lo, int hi, int *out, int max);
+void printRange(BSTNode *root, int lo, int hi);
+void printSmallerValues(BSTNode *node, int m);
+
+void initRangeIterator(BSTIterator *it, BSTNode *root, int lo, int hi);
+int nextInRange(BSTIterator *it, int *value);
+void freeIterator(BSTIterator *it);
+
+void removeAll(BSTNode **node);
+
+void benchmarkRangeScan(int n, int queries);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j, value;
+	BSTIterator it;
+	c = 1;
+
+	//Initialize the Binary Search Tree as an empty Binary Search Tree
+	BSTNode *root;
+	root = NULL;
+	initRangeIterator(&it, NULL, 0, 0);
+
+	printf("1: Insert an integer into the binary search tree;\n");
+	printf("2: Print the integers in a range [lo, hi];\n");
+	printf("3: Print the values smaller than m (pre-order);\n");
+	printf("4: Start a range iterator over [lo, hi];\n");
+	printf("5: Print the next k integers from the iterator;\n");
+	printf("6: Run the range scan vs full traversal benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-6/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the Binary Search Tree: ");
+			scanf("%d", &i);
+			insertBSTNode(&root, i);
+			freeIterator(&it);		// the tree changed
+			break;
+		case 2:
+			printf("Input the range lo and hi: ");
+			scanf("%d %d", &i, &j);
+			printf("The integers in the range are: ");
+			printRange(root, i, j);
+			printf("\n");
+			break;
+		case 3:
+			printf("Input m: ");
+			scanf("%d", &i);
+			printf("The values smaller than %d are: ", i);
+			printSmallerValues(root, i);
+			printf("\n");
+			break;
+		case 4:
+			printf("Input the range lo and hi: ");
+			scanf("%d %d", &i, &j);
+			freeIterator(&it);
+			initRangeIterator(&it, root, i, j);
+			break;
+		case 5:
+			printf("Input k: ");
+			scanf("%d", &i);
+			printf("The next integers are: ");
+			while (i-- > 0 && nextInRange(&it, &value))
+				printf("%d ", value);
+			printf("\n");
+			break;
+		case 6:
+			printf("Input the number of keys and the number of queries: ");
+			scanf("%d %d", &i, &j);
+			benchmarkRangeScan(i, j);
+			break;
+		case 0:
+			freeIterator(&it);
+			removeAll(&root);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static long long nodesVisited = 0;	// counted for the benchmark
+
+void insertBSTNode(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertBSTNode(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertBSTNode(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+// 범위 [lo, hi]의 키를 오름차순으로 out에 최대 max개 저장하고 개수를 반환
+// - item < lo이면 왼쪽 서브트리는 전부 lo보다 작으므로 건너뜀 (hi 쪽도 마찬가지)
+int collectRange(BSTNode *root, int lo, int hi, int *out, int max)
+{
+	int count = 0;
+
+	if (root == NULL || max <= 0)
+		return 0;
+	nodesVisited++;
+	if (root->item > lo)
+		count = collectRange(root->left, lo, hi, out, max);
+	if (root->item >= lo && root->item <= hi && count < max)
+		out[count++] = root->item;
+	if (root->item < hi)
+		count += collectRange(root->right, lo, hi, out + count, max - count);
+	return count;
+}
+
+void printRange(BSTNode *root, int lo, int hi)
+{
+	BSTIterator it;
+	int value;
+
+	initRangeIterator(&it, root, lo, hi);
+	while (nextInRange(&it, &value))
+		printf("%d ", value);
+	freeIterator(&it);
+}
+
+// Q6_E_BT.c의 printSmallerValues와 같은 전위 순서 출력
+// - BST에서는 item >= m인 노드의 오른쪽 서브트리를 볼 필요가 없음
+void printSmallerValues(BSTNode *node, int m)
+{
+	if (node == NULL)
+		return;
+	if (node->item < m)
+		printf("%d ", node->item);
+	printSmallerValues(node->left, m);
+	if (node->item < m)
+		printSmallerValues(node->right, m);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static void pushNode(BSTIterator *it, BSTNode *node)
+{
+	BSTNode **bigger;
+	int i;
+
+	if (it->top == it->capacity) {
+		// 트리가 깊을 때만 힙으로 옮기고 두 배씩 늘림
+		bigger = malloc(sizeof(BSTNode*) * it->capacity * 2);
+		if (bigger == NULL)
+			exit(0);
+		for (i = 0; i < it->top; i++)
+			bigger[i] = it->stack[i];
+		if (it->stack != it->inlineStack)
+			free(it->stack);
+		it->stack = bigger;
+		it->capacity *= 2;
+	}
+	it->stack[it->top++] = node;
+	nodesVisited++;
+}
+
+// lo를 찾아 내려가면서 lo 이상인 노드만 쌓음 -> top이 lo 이상인 가장 작은 키
+void initRangeIterator(BSTIterator *it, BSTNode *root, int lo, int hi)
+{
+	it->stack = it->inlineStack;
+	it->top = 0;
+	it->capacity = ITER_INLINE;
+	it->hi = hi;
+	if (lo > hi)
+		return;
+	while (root != NULL) {
+		if (root->item >= lo) {
+			pushNode(it, root);
+			root = root->left;
+		}
+		else {
+			nodesVisited++;
+			root = root->right;
+		}
+	}
+}
+
+// Stores the next key in *value and returns 1, or returns 0 past hi
+int nextInRange(BSTIterator *it, int *value)
+{
+	BSTNode *node;
+
+	if (it->top == 0)
+		return 0;
+	node = it->stack[--it->top];
+	if (node->item > it->hi) {
+		it->top = 0;
+		return 0;
+	}
+	*value = node->item;
+	// 다음 키는 오른쪽 서브트리의 가장 왼쪽 (오른쪽은 모두 lo보다 큼)
+	for (node = node->right; node != NULL; node = node->left)
+		pushNode(it, node);
+	return 1;
+}
+
+void freeIterator(BSTIterator *it)
+{
+	if (it->stack != it->inlineStack)
+		free(it->stack);
+	it->stack = it->inlineStack;
+	it->top = 0;
+	it->capacity = ITER_INLINE;
+}
+
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 지금처럼 모든 노드를 방문하면서 범위 안의 키만 고르는 방식
+static int fullScan(BSTNode *node, int lo, int hi, long long *sum)
+{
+	if (node == NULL)
+		return 0;
+	nodesVisited++;
+	if (node->item >= lo && node->item <= hi)
+		*sum += node->item;
+	return (node->item >= lo && node->item <= hi) + fullScan(node->left, lo, hi, sum)
+		+ fullScan(node->right, lo, hi, sum);
+}
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// 무작위 순서로 넣은 키 0..n-1에 대해 결과가 약 k개인 범위 질의를 세 방식으로 실행
+void benchmarkRangeScan(int n, int queries)
+{
+	static const int widths[] = { 10, 100, 1000 };
+	BSTNode *root = NULL;
+	BSTIterator it;
+	clock_t start;
+	int *keys, *out;
+	long long sums[3], visits[3];
+	double seconds[3];
+	int w, method, q, i, j, tmp, lo, value, fullQueries;
+
+	if (n <= 0 || queries <= 0)
+		return;
+	keys = malloc(sizeof(int) * n);
+	out = malloc(sizeof(int) * 1000);
+	if (keys == NULL || out == NULL) {
+		free(keys);
+		free(out);
+		return;
+	}
+	for (i = 0; i < n; i++)
+		keys[i] = i;
+	for (i = n - 1; i > 0; i--) {
+		j = rand() % (i + 1);
+		tmp = keys[i];
+		keys[i] = keys[j];
+		keys[j] = tmp;
+	}
+	for (i = 0; i < n; i++)
+		insertBSTNode(&root, keys[i]);
+	// 전체 순회는 질의당 O(n)이므로 약 10^8 노드 분량까지만 실행
+	fullQueries = (int)(100000000LL / n);
+	if (fullQueries < 1)
+		fullQueries = 1;
+	if (fullQueries > queries)
+		fullQueries = queries;
+
+	printf("n = %d, %d queries (%d for the full traversal):\n", n, queries, fullQueries);
+	for (w = 0; w < 3; w++) {
+		for (method = 0; method < 3; method++) {
+			srand(w + 1);
+			sums[method] = 0;
+			nodesVisited = 0;
+			start = clock();
+			for (q = 0; q < (method == 0 ? fullQueries : queries); q++) {
+				lo = rand() % n;
+				if (method == 0) {
+					fullScan(root, lo, lo + widths[w] - 1, &sums[method]);
+				}
+				else if (method == 1) {
+					j = collectRange(root, lo, lo + widths[w] - 1, out, 1000);
+					for (i = 0; i < j; i++)
+						sums[method] += out[i];
+				}
+				else {
+					initRangeIterator(&it, root, lo, lo + widths[w] - 1);
+					while (nextInRange(&it, &value))
+						sums[method] += value;
+					freeIterator(&it);
+				}
+				if (method != 0 && q + 1 == fullQueries && sums[method] != sums[0])
+					printf("  results differ!\n");
+			}
+			seconds[method] = elapsed(start) / (method == 0 ? fullQueries : queries);
+			visits[method] = nodesVisited / (method == 0 ? fullQueries : queries);
+		}
+		printf("  k ~ %4d: full traversal %10.1f ns (%lld nodes), collectRange %8.1f ns (%lld nodes), "
+			"iterator %8.1f ns (%lld nodes)\n", widths[w], seconds[0] * 1e9, visits[0],
+			seconds[1] * 1e9, visits[1], seconds[2] * 1e9, visits[2]);
+	}
+
+	removeAll(&root);
+	free(keys);
+	free(out);
+}
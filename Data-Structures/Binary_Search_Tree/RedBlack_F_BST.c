@@ -0,0 +1,971 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: Red-black tree insert/delete/search behind the BSTNode API, with the
+		 Q1-Q5 traversal entry points and a mixed insert/delete benchmark
+		 against the AVL tree and the plain BST */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define RED 0
+#define BLACK 1
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+	struct _bstnode *parent;	// NULL for the root
+	int color;					// RED or BLACK; NULL children count as BLACK
+} BSTNode;
+
+typedef struct _QueueNode {
+	BSTNode *data;
+	struct _QueueNode *nextPtr;
+}QueueNode;
+
+typedef struct _queue
+{
+	QueueNode *head;
+	QueueNode *tail;
+}Queue;
+
+typedef struct _stackNode{
+	BSTNode *data;
+	struct _stackNode *next;
+}StackNode;
+
+typedef struct _stack
+{
+	StackNode *top;
+}Stack;
+
+typedef struct _avlnode{
+	int item;
+	struct _avlnode *left;
+	struct _avlnode *right;
+	int height;
+} AVLNode;	// AVL tree and plain BST, only used by the benchmark
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **root, int value);
+BSTNode* removeNodeFromTree(BSTNode *root, int value);
+BSTNode* searchBSTNode(BSTNode *root, int value);
+int checkRedBlack(BSTNode *root);
+
+void levelOrderTraversal(BSTNode *root);
+void inOrderIterative(BSTNode *root);
+void preOrderIterative(BSTNode *root);
+void postOrderIterativeS1(BSTNode *root);
+void postOrderIterativeS2(BSTNode *root);
+
+BSTNode* dequeue(QueueNode **head, QueueNode **tail);
+void enqueue(QueueNode **head, QueueNode **tail, BSTNode *node);
+int isEmpty(QueueNode *head);
+void push(Stack *stack, BSTNode *node);
+BSTNode* pop(Stack *s);
+BSTNode* peek(Stack *s);
+int isEmptyStack(Stack *s);
+void removeAll(BSTNode **node);
+
+void benchmarkTrees(int n, int ops);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j;
+	c = 1;
+
+	//Initialize the Binary Search Tree as an empty Binary Search Tree
+	BSTNode *root;
+	root = NULL;
+
+	printf("1: Insert an integer into the red-black tree;\n");
+	printf("2: Remove an integer from the red-black tree;\n");
+	printf("3: Print the level-order traversal;\n");
+	printf("4: Print the in-order traversal;\n");
+	printf("5: Print the pre-order traversal;\n");
+	printf("6: Print the post-order traversal (one stack);\n");
+	printf("7: Print the post-order traversal (two stacks);\n");
+	printf("8: Check the red-black properties;\n");
+	printf("9: Run the red-black vs AVL vs plain BST benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-9/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the red-black tree: ");
+			scanf("%d", &i);
+			insertBSTNode(&root, i);
+			break;
+		case 2:
+			printf("Input an integer that you want to remove from the red-black tree: ");
+			scanf("%d", &i);
+			root = removeNodeFromTree(root, i);
+			break;
+		case 3:
+			printf("The resulting level-order traversal is: ");
+			levelOrderTraversal(root);
+			printf("\n");
+			break;
+		case 4:
+			printf("The resulting in-order traversal is: ");
+			inOrderIterative(root);
+			printf("\n");
+			break;
+		case 5:
+			printf("The resulting pre-order traversal is: ");
+			preOrderIterative(root);
+			printf("\n");
+			break;
+		case 6:
+			printf("The resulting post-order traversal is: ");
+			postOrderIterativeS1(root);
+			printf("\n");
+			break;
+		case 7:
+			printf("The resulting post-order traversal is: ");
+			postOrderIterativeS2(root);
+			printf("\n");
+			break;
+		case 8:
+			i = checkRedBlack(root);
+			if (i == -1)
+				printf("The tree is NOT a valid red-black tree\n");
+			else
+				printf("The tree is a valid red-black tree with black height %d\n", i);
+			break;
+		case 9:
+			printf("Input the initial number of keys and the number of operations: ");
+			scanf("%d %d", &i, &j);
+			benchmarkTrees(i, j);
+			break;
+		case 0:
+			removeAll(&root);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static long long rotations = 0;	// counted for the benchmark
+
+static int colorOf(BSTNode *node)
+{
+	return node == NULL ? BLACK : node->color;
+}
+
+// x의 오른쪽 자식 y를 x 자리로 올림 (부모 포인터까지 갱신)
+static void rotateLeft(BSTNode **root, BSTNode *x)
+{
+	BSTNode *y = x->right;
+
+	x->right = y->left;
+	if (y->left != NULL)
+		y->left->parent = x;
+	y->parent = x->parent;
+	if (x->parent == NULL)
+		*root = y;
+	else if (x == x->parent->left)
+		x->parent->left = y;
+	else
+		x->parent->right = y;
+	y->left = x;
+	x->parent = y;
+	rotations++;
+}
+
+static void rotateRight(BSTNode **root, BSTNode *x)
+{
+	BSTNode *y = x->left;
+
+	x->left = y->right;
+	if (y->right != NULL)
+		y->right->parent = x;
+	y->parent = x->parent;
+	if (x->parent == NULL)
+		*root = y;
+	else if (x == x->parent->right)
+		x->parent->right = y;
+	else
+		x->parent->left = y;
+	y->right = x;
+	x->parent = y;
+	rotations++;
+}
+
+// 빨간 노드 z의 부모도 빨간색이면 위반
+// - 삼촌이 빨간색: 부모/삼촌을 검게, 조부모를 빨갛게 하고 조부모에서 다시 검사
+// - 삼촌이 검은색: 최대 두 번 회전으로 끝
+static void insertFixup(BSTNode **root, BSTNode *z)
+{
+	BSTNode *p, *g, *uncle;
+
+	while ((p = z->parent) != NULL && p->color == RED) {
+		g = p->parent;	// 빨간 부모는 루트가 아니므로 조부모가 있음
+		if (p == g->left) {
+			uncle = g->right;
+			if (colorOf(uncle) == RED) {
+				p->color = BLACK;
+				uncle->color = BLACK;
+				g->color = RED;
+				z = g;
+				continue;
+			}
+			if (z == p->right) {
+				rotateLeft(root, p);
+				z = p;
+				p = z->parent;
+			}
+			p->color = BLACK;
+			g->color = RED;
+			rotateRight(root, g);
+		}
+		else {
+			uncle = g->left;
+			if (colorOf(uncle) == RED) {
+				p->color = BLACK;
+				uncle->color = BLACK;
+				g->color = RED;
+				z = g;
+				continue;
+			}
+			if (z == p->left) {
+				rotateRight(root, p);
+				z = p;
+				p = z->parent;
+			}
+			p->color = BLACK;
+			g->color = RED;
+			rotateLeft(root, g);
+		}
+	}
+	(*root)->color = BLACK;
+}
+
+// Same contract as the plain insertBSTNode(): duplicates are ignored
+void insertBSTNode(BSTNode **root, int value)
+{
+	BSTNode *parent = NULL, **link = root, *node;
+
+	while (*link != NULL) {
+		parent = *link;
+		if (value < parent->item)
+			link = &(parent->left);
+		else if (value > parent->item)
+			link = &(parent->right);
+		else
+			return;
+	}
+	node = malloc(sizeof(BSTNode));
+	if (node == NULL)
+		exit(0);
+	node->item = value;
+	node->left = NULL;
+	node->right = NULL;
+	node->parent = parent;
+	node->color = RED;
+	*link = node;
+	insertFixup(root, node);
+}
+
+static void transplant(BSTNode **root, BSTNode *u, BSTNode *v)
+{
+	if (u->parent == NULL)
+		*root = v;
+	else if (u == u->parent->left)
+		u->parent->left = v;
+	else
+		u->parent->right = v;
+	if (v != NULL)
+		v->parent = u->parent;
+}
+
+// 검은 노드가 빠져서 x 쪽 경로의 검은 높이가 하나 모자람 (x는 NULL일 수 있으므로 parent를 따로 받음)
+// - 형제 w의 색과 w 자식들의 색에 따라 4가지 경우, 회전은 최대 세 번
+static void deleteFixup(BSTNode **root, BSTNode *x, BSTNode *parent)
+{
+	BSTNode *w;
+
+	while (x != *root && colorOf(x) == BLACK) {
+		if (x == parent->left) {
+			w = parent->right;
+			if (colorOf(w) == RED) {
+				w->color = BLACK;
+				parent->color = RED;
+				rotateLeft(root, parent);
+				w = parent->right;
+			}
+			if (colorOf(w->left) == BLACK && colorOf(w->right) == BLACK) {
+				w->color = RED;
+				x = parent;
+				parent = x->parent;
+				continue;
+			}
+			if (colorOf(w->right) == BLACK) {
+				w->left->color = BLACK;
+				w->color = RED;
+				rotateRight(root, w);
+				w = parent->right;
+			}
+			w->color = parent->color;
+			parent->color = BLACK;
+			w->right->color = BLACK;
+			rotateLeft(root, parent);
+		}
+		else {
+			w = parent->left;
+			if (colorOf(w) == RED) {
+				w->color = BLACK;
+				parent->color = RED;
+				rotateRight(root, parent);
+				w = parent->left;
+			}
+			if (colorOf(w->left) == BLACK && colorOf(w->right) == BLACK) {
+				w->color = RED;
+				x = parent;
+				parent = x->parent;
+				continue;
+			}
+			if (colorOf(w->left) == BLACK) {
+				w->right->color = BLACK;
+				w->color = RED;
+				rotateLeft(root, w);
+				w = parent->left;
+			}
+			w->color = parent->color;
+			parent->color = BLACK;
+			w->left->color = BLACK;
+			rotateRight(root, parent);
+		}
+		x = *root;
+	}
+	if (x != NULL)
+		x->color = BLACK;
+}
+
+// Same contract as Q5: returns the new root. A node with two children is
+// replaced by its in-order successor (the successor node itself moves up,
+// so pointers to other nodes stay valid).
+BSTNode* removeNodeFromTree(BSTNode *root, int value)
+{
+	BSTNode *z = searchBSTNode(root, value), *y, *x, *xParent;
+	int removedColor;
+
+	if (z == NULL)
+		return root;
+
+	removedColor = z->color;
+	if (z->left == NULL) {
+		x = z->right;
+		xParent = z->parent;
+		transplant(&root, z, z->right);
+	}
+	else if (z->right == NULL) {
+		x = z->left;
+		xParent = z->parent;
+		transplant(&root, z, z->left);
+	}
+	else {
+		y = z->right;
+		while (y->left != NULL)
+			y = y->left;
+		removedColor = y->color;
+		x = y->right;
+		if (y->parent == z) {
+			xParent = y;
+		}
+		else {
+			xParent = y->parent;
+			transplant(&root, y, y->right);
+			y->right = z->right;
+			y->right->parent = y;
+		}
+		transplant(&root, z, y);
+		y->left = z->left;
+		y->left->parent = y;
+		y->color = z->color;
+	}
+	free(z);
+	if (removedColor == BLACK)
+		deleteFixup(&root, x, xParent);
+	return root;
+}
+
+BSTNode* searchBSTNode(BSTNode *root, int value)
+{
+	while (root != NULL && root->item != value)
+		root = value < root->item ? root->left : root->right;
+	return root;
+}
+
+// 순서, 부모 포인터, 빨강-빨강 금지, 모든 경로의 검은 높이가 같은지 검사
+static int checkSubtree(BSTNode *node, BSTNode *parent, long long lo, long long hi)
+{
+	int lh, rh;
+
+	if (node == NULL)
+		return 1;
+	if (node->parent != parent || node->item <= lo || node->item >= hi)
+		return -1;
+	if (node->color == RED && (colorOf(node->left) == RED || colorOf(node->right) == RED))
+		return -1;
+	lh = checkSubtree(node->left, node, lo, node->item);
+	rh = checkSubtree(node->right, node, node->item, hi);
+	if (lh == -1 || rh == -1 || lh != rh)
+		return -1;
+	return lh + (node->color == BLACK);
+}
+
+// Black height (counting the NULL leaves) if valid, -1 otherwise
+int checkRedBlack(BSTNode *root)
+{
+	if (colorOf(root) != BLACK)
+		return -1;
+	return checkSubtree(root, NULL, -2147483649LL, 2147483648LL);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Traversals: the same entry points as Q1-Q5. Q1 and Q5 are unchanged; the
+// Q2-Q4 versions unlink nodes while printing, which would break the colouring,
+// so those three are the usual non-destructive stack walks.
+
+void levelOrderTraversal(BSTNode* root)
+{
+	if (root == NULL)
+		return;
+	Queue *queue = (Queue*)malloc(sizeof(Queue));
+	queue->head = NULL;
+	queue->tail = NULL;
+	enqueue(&queue->head, &queue->tail, root);
+
+	while (!isEmpty(queue->head)) {
+		BSTNode *node = dequeue(&queue->head, &queue->tail);
+		printf("%d ", node->item);
+		if (node->left)
+			enqueue(&queue->head, &queue->tail, node->left);
+		if (node->right)
+			enqueue(&queue->head, &queue->tail, node->right);
+	}
+	free(queue);
+}
+
+// 왼쪽 끝까지 쌓고, 꺼내서 출력한 뒤 오른쪽 서브트리로
+void inOrderIterative(BSTNode *root)
+{
+	Stack s = { NULL };
+	BSTNode *cur = root;
+
+	while (cur != NULL || !isEmptyStack(&s)) {
+		while (cur != NULL) {
+			push(&s, cur);
+			cur = cur->left;
+		}
+		cur = pop(&s);
+		printf("%d ", cur->item);
+		cur = cur->right;
+	}
+}
+
+void preOrderIterative(BSTNode *root)
+{
+	Stack s = { NULL };
+	BSTNode *node;
+
+	if (root == NULL)
+		return;
+	push(&s, root);
+	while (!isEmptyStack(&s)) {
+		node = pop(&s);
+		printf("%d ", node->item);
+		if (node->right)
+			push(&s, node->right);
+		if (node->left)
+			push(&s, node->left);
+	}
+}
+
+// 스택 top의 오른쪽 서브트리를 방금 끝냈을 때(lastVisited)만 top을 출력
+void postOrderIterativeS1(BSTNode *root)
+{
+	Stack s = { NULL };
+	BSTNode *cur = root, *lastVisited = NULL, *top;
+
+	while (cur != NULL || !isEmptyStack(&s)) {
+		if (cur != NULL) {
+			push(&s, cur);
+			cur = cur->left;
+			continue;
+		}
+		top = peek(&s);
+		if (top->right != NULL && top->right != lastVisited) {
+			cur = top->right;
+		}
+		else {
+			printf("%d ", top->item);
+			lastVisited = pop(&s);
+		}
+	}
+}
+
+void postOrderIterativeS2(BSTNode *root) {
+    if (root == NULL) return;
+
+    Stack *s1 = (Stack *)malloc(sizeof(Stack));
+    Stack *s2 = (Stack *)malloc(sizeof(Stack));
+    s1->top = NULL;
+    s2->top = NULL;
+
+    push(s1, root);
+    while (!isEmptyStack(s1)) {
+        BSTNode *node = pop(s1);
+        push(s2, node);
+
+        if (node->left)  push(s1, node->left);
+        if (node->right) push(s1, node->right);
+    }
+
+    while (!isEmptyStack(s2)) {
+        BSTNode *node = pop(s2);
+        printf("%d ", node->item);
+    }
+
+    free(s1);
+    free(s2);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// enqueue node
+void enqueue(QueueNode **headPtr, QueueNode **tailPtr, BSTNode *node)
+{
+	// dynamically allocate memory
+	QueueNode *newPtr = malloc(sizeof(QueueNode));
+
+	// if newPtr does not equal NULL
+	if (newPtr != NULL) {
+		newPtr->data = node;
+		newPtr->nextPtr = NULL;
+
+		// if queue is empty, insert at head
+		if (isEmpty(*headPtr)) {
+			*headPtr = newPtr;
+		}
+		else { // insert at tail
+			(*tailPtr)->nextPtr = newPtr;
+		}
+
+		*tailPtr = newPtr;
+	}
+	else {
+		printf("Node not inserted");
+	}
+}
+
+BSTNode* dequeue(QueueNode **headPtr, QueueNode **tailPtr)
+{
+	BSTNode *node = (*headPtr)->data;
+	QueueNode *tempPtr = *headPtr;
+	*headPtr = (*headPtr)->nextPtr;
+
+	if (*headPtr == NULL) {
+		*tailPtr = NULL;
+	}
+
+	free(tempPtr);
+
+	return node;
+}
+
+int isEmpty(QueueNode *head)
+{
+	return head == NULL;
+}
+
+void push(Stack *stack, BSTNode * node)
+{
+	StackNode *temp;
+
+	temp = malloc(sizeof(StackNode));
+
+	if (temp == NULL)
+		return;
+	temp->data = node;
+	temp->next = stack->top;
+	stack->top = temp;
+}
+
+BSTNode * pop(Stack * s)
+{
+	StackNode *t;
+	BSTNode * ptr;
+	ptr = NULL;
+
+	t = s->top;
+	if (t != NULL)
+	{
+		ptr = t->data;
+		s->top = t->next;
+		free(t);
+	}
+
+	return ptr;
+}
+
+BSTNode * peek(Stack * s)
+{
+	StackNode *temp;
+	temp = s->top;
+	if (temp != NULL)
+		return temp->data;
+	else
+		return NULL;
+}
+
+int isEmptyStack(Stack *s)
+{
+	if (s->top == NULL)
+		return 1;
+	else
+		return 0;
+}
+
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// AVL tree (as in AVL_F_BST.c) and plain BST (iterative), for the benchmark
+
+static int avlHeight(AVLNode *node)
+{
+	return node == NULL ? 0 : node->height;
+}
+
+static void avlUpdate(AVLNode *node)
+{
+	int lh = avlHeight(node->left), rh = avlHeight(node->right);
+	node->height = 1 + (lh > rh ? lh : rh);
+}
+
+static AVLNode* avlRotateRight(AVLNode *y)
+{
+	AVLNode *x = y->left;
+
+	y->left = x->right;
+	x->right = y;
+	avlUpdate(y);
+	avlUpdate(x);
+	rotations++;
+	return x;
+}
+
+static AVLNode* avlRotateLeft(AVLNode *x)
+{
+	AVLNode *y = x->right;
+
+	x->right = y->left;
+	y->left = x;
+	avlUpdate(x);
+	avlUpdate(y);
+	rotations++;
+	return y;
+}
+
+static AVLNode* avlRebalance(AVLNode *node)
+{
+	int balance;
+
+	avlUpdate(node);
+	balance = avlHeight(node->left) - avlHeight(node->right);
+	if (balance > 1) {
+		if (avlHeight(node->left->left) < avlHeight(node->left->right))
+			node->left = avlRotateLeft(node->left);
+		return avlRotateRight(node);
+	}
+	if (balance < -1) {
+		if (avlHeight(node->right->right) < avlHeight(node->right->left))
+			node->right = avlRotateRight(node->right);
+		return avlRotateLeft(node);
+	}
+	return node;
+}
+
+static AVLNode* newAVLNode(int value)
+{
+	AVLNode *node = malloc(sizeof(AVLNode));
+
+	if (node == NULL)
+		exit(0);
+	node->item = value;
+	node->left = NULL;
+	node->right = NULL;
+	node->height = 1;
+	return node;
+}
+
+static AVLNode* avlInsert(AVLNode *node, int value)
+{
+	if (node == NULL)
+		return newAVLNode(value);
+	if (value < node->item)
+		node->left = avlInsert(node->left, value);
+	else if (value > node->item)
+		node->right = avlInsert(node->right, value);
+	else
+		return node;
+	return avlRebalance(node);
+}
+
+static AVLNode* avlRemove(AVLNode *root, int value)
+{
+	AVLNode *temp, *successor;
+
+	if (root == NULL)
+		return NULL;
+	if (value < root->item)
+		root->left = avlRemove(root->left, value);
+	else if (value > root->item)
+		root->right = avlRemove(root->right, value);
+	else {
+		if (root->left == NULL || root->right == NULL) {
+			temp = root->left != NULL ? root->left : root->right;
+			free(root);
+			return temp;
+		}
+		successor = root->right;
+		while (successor->left != NULL)
+			successor = successor->left;
+		root->item = successor->item;
+		root->right = avlRemove(root->right, successor->item);
+	}
+	return avlRebalance(root);
+}
+
+static AVLNode* avlSearch(AVLNode *root, int value)
+{
+	while (root != NULL && root->item != value)
+		root = value < root->item ? root->left : root->right;
+	return root;
+}
+
+static void plainInsert(AVLNode **link, int value)
+{
+	while (*link != NULL) {
+		if (value < (*link)->item)
+			link = &((*link)->left);
+		else if (value > (*link)->item)
+			link = &((*link)->right);
+		else
+			return;
+	}
+	*link = newAVLNode(value);
+}
+
+static void plainRemove(AVLNode **link, int value)
+{
+	AVLNode *target, **succLink;
+
+	while (*link != NULL && (*link)->item != value)
+		link = value < (*link)->item ? &((*link)->left) : &((*link)->right);
+	if (*link == NULL)
+		return;
+	target = *link;
+	if (target->left != NULL && target->right != NULL) {
+		succLink = &(target->right);
+		while ((*succLink)->left != NULL)
+			succLink = &((*succLink)->left);
+		target->item = (*succLink)->item;
+		link = succLink;
+		target = *link;
+	}
+	*link = target->left != NULL ? target->left : target->right;
+	free(target);
+}
+
+// Frees any shape without recursion (the plain BST may be a long chain)
+static void freeAVL(AVLNode *node)
+{
+	AVLNode *left;
+
+	while (node != NULL) {
+		if (node->left == NULL) {
+			left = node->right;
+			free(node);
+			node = left;
+		}
+		else {
+			// 왼쪽 자식을 위로 올려서 왼쪽이 빌 때까지 회전
+			left = node->left;
+			node->left = left->right;
+			left->right = node;
+			node = left;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#define OP_INSERT 0
+#define OP_REMOVE 1
+#define OP_SEARCH 2
+
+typedef struct _traceop
+{
+	int op;
+	int key;
+} TraceOp;
+
+// kind 0-2: random keys with insert/remove/search percentages from mixes[kind]
+// kind 3: sliding window over ascending keys (insert key i, remove key i - n)
+static void makeTrace(TraceOp *trace, int n, int ops, int kind)
+{
+	static const int mixes[3][2] = { { 70, 20 }, { 40, 40 }, { 20, 60 } };
+	int i, r;
+
+	for (i = 0; i < ops; i++) {
+		if (kind == 3) {
+			trace[i].op = i % 2 == 0 ? OP_INSERT : OP_REMOVE;
+			trace[i].key = i % 2 == 0 ? n + i / 2 : i / 2;
+			continue;
+		}
+		r = rand() % 100;
+		trace[i].op = r < mixes[kind][0] ? OP_INSERT : r < mixes[kind][0] + mixes[kind][1] ? OP_REMOVE : OP_SEARCH;
+		trace[i].key = rand() % (2 * n);
+	}
+}
+
+// engine 0 = red-black, 1 = AVL, 2 = plain BST; returns seconds, *found counts search hits
+static double replay(int engine, const int *initial, int n, const TraceOp *trace, int ops, long long *found)
+{
+	BSTNode *rb = NULL;
+	AVLNode *avl = NULL;
+	clock_t start;
+	double seconds;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (engine == 0)
+			insertBSTNode(&rb, initial[i]);
+		else if (engine == 1)
+			avl = avlInsert(avl, initial[i]);
+		else
+			plainInsert(&avl, initial[i]);
+	}
+	rotations = 0;
+	*found = 0;
+	start = clock();
+	for (i = 0; i < ops; i++) {
+		switch (trace[i].op) {
+		case OP_INSERT:
+			if (engine == 0)
+				insertBSTNode(&rb, trace[i].key);
+			else if (engine == 1)
+				avl = avlInsert(avl, trace[i].key);
+			else
+				plainInsert(&avl, trace[i].key);
+			break;
+		case OP_REMOVE:
+			if (engine == 0)
+				rb = removeNodeFromTree(rb, trace[i].key);
+			else if (engine == 1)
+				avl = avlRemove(avl, trace[i].key);
+			else
+				plainRemove(&avl, trace[i].key);
+			break;
+		default:
+			if (engine == 0)
+				*found += searchBSTNode(rb, trace[i].key) != NULL;
+			else
+				*found += avlSearch(avl, trace[i].key) != NULL;
+			break;
+		}
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	if (engine == 0 && checkRedBlack(rb) == -1)
+		printf("  red-black check FAILED\n");
+	removeAll(&rb);
+	freeAVL(avl);
+	return seconds;
+}
+
+// n개를 미리 넣은 뒤 같은 연산 순서를 세 트리에 그대로 재생
+void benchmarkTrees(int n, int ops)
+{
+	static const char *traceNames[] = {
+		"random 70% insert / 20% delete / 10% search",
+		"random 40% insert / 40% delete / 20% search",
+		"random 20% insert / 60% delete / 20% search",
+		"ascending sliding window (insert newest, delete oldest)"
+	};
+	static const char *engineNames[] = { "red-black", "AVL      ", "plain BST" };
+	TraceOp *trace;
+	int *initial;
+	long long found[3];
+	double seconds;
+	int kind, engine, i;
+
+	if (n <= 0 || ops <= 0)
+		return;
+	trace = malloc(sizeof(TraceOp) * ops);
+	initial = malloc(sizeof(int) * n);
+	if (trace == NULL || initial == NULL) {
+		free(trace);
+		free(initial);
+		return;
+	}
+
+	for (kind = 0; kind < 4; kind++) {
+		for (i = 0; i < n; i++)
+			initial[i] = kind == 3 ? i : rand() % (2 * n);
+		makeTrace(trace, n, ops, kind);
+		printf("%s, %d keys, %d ops:\n", traceNames[kind], n, ops);
+		for (engine = 0; engine < 3; engine++) {
+			if (engine == 2 && kind == 3 && n > 20000) {
+				printf("  %s: skipped (the tree degenerates into a list)\n", engineNames[engine]);
+				continue;
+			}
+			seconds = replay(engine, initial, n, trace, ops, &found[engine]);
+			printf("  %s: %.3f s (%.1f ns/op), %.3f rotations/op\n", engineNames[engine], seconds,
+				seconds * 1e9 / ops, (double)rotations / ops);
+		}
+		if (found[0] != found[1] || (!(kind == 3 && n > 20000) && found[0] != found[2]))
+			printf("  search results differ!\n");
+	}
+	free(trace);
+	free(initial);
+}
@@ -0,0 +1,450 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section F - Binary Search Trees
+Purpose: Slab pool allocator for BSTNode so that a whole tree is released in
+		 O(1) (resetPool) or O(chunks) (destroyPool) without visiting its nodes,
+		 and a teardown benchmark against recursive and iterative removeAll */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define POOL_CHUNK_NODES 1024	// 1024 * 24 bytes = one 24KB slab per chunk
+
+///////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;
+
+typedef struct _poolchunk{
+	struct _poolchunk *next;
+	BSTNode nodes[POOL_CHUNK_NODES];
+} PoolChunk;
+
+// Slabs are kept oldest first so that resetPool() can rewind the bump
+// pointer to the first slab and hand the same memory out again
+typedef struct _nodepool{
+	PoolChunk *chunks;		// every slab allocated so far, oldest first
+	PoolChunk *current;		// slab that bumpIndex points into
+	BSTNode *freeList;		// recycled nodes, linked through BSTNode.right
+	int bumpIndex;			// next untouched node in current
+	int chunkCount;
+	int liveNodes;
+} NodePool;
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void initPool(NodePool *pool);
+void resetPool(NodePool *pool);
+void destroyPool(NodePool *pool);
+BSTNode *allocNode(NodePool *pool);
+void freeNode(NodePool *pool, BSTNode *node);
+void printPoolStats(NodePool *pool);
+
+void insertBSTNode(NodePool *pool, BSTNode **node, int value);
+void inOrderTraversal(BSTNode *node);
+void releaseTree(NodePool *pool, BSTNode **node);
+
+void insertBSTNodeMalloc(BSTNode **node, int value);
+void removeAllRecursive(BSTNode **node);
+void removeAll(BSTNode **node);
+
+void benchmarkTeardown(int n);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+	NodePool pool;
+	int c, i;
+	c = 1;
+
+	//Initialize the Binary Search Tree as an empty pool-backed Binary Search Tree
+	BSTNode *root;
+	root = NULL;
+	initPool(&pool);
+
+	printf("1: Insert an integer into the binary search tree;\n");
+	printf("2: Print the in-order traversal of the binary search tree;\n");
+	printf("3: Release the tree node by node into the pool free list;\n");
+	printf("4: Release the tree at once by resetting the pool;\n");
+	printf("5: Print the pool statistics;\n");
+	printf("6: Run the removeAll vs pool release benchmark;\n");
+	printf("0: Quit;\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-6/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the Binary Search Tree: ");
+			scanf("%d", &i);
+			insertBSTNode(&pool, &root, i);
+			break;
+		case 2:
+			printf("The resulting in-order traversal of the binary search tree is: ");
+			inOrderTraversal(root);
+			printf("\n");
+			break;
+		case 3:
+			releaseTree(&pool, &root);
+			printPoolStats(&pool);
+			break;
+		case 4:
+			// 이 풀에는 root 트리만 들어 있으므로 노드를 하나도 보지 않고 통째로 반납
+			resetPool(&pool);
+			root = NULL;
+			printPoolStats(&pool);
+			break;
+		case 5:
+			printPoolStats(&pool);
+			break;
+		case 6:
+			printf("Input the number of keys: ");
+			scanf("%d", &i);
+			benchmarkTeardown(i);
+			break;
+		case 0:
+			destroyPool(&pool);
+			root = NULL;
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void initPool(NodePool *pool)
+{
+	pool->chunks = NULL;
+	pool->current = NULL;
+	pool->freeList = NULL;
+	pool->bumpIndex = POOL_CHUNK_NODES;	// 첫 할당 때 슬랩을 새로 잡도록
+	pool->chunkCount = 0;
+	pool->liveNodes = 0;
+}
+
+// 모든 노드를 한 번에 반납하되 슬랩은 그대로 두고 재사용 - 노드 수와 무관하게 O(1)
+// - 이 풀에서 할당한 포인터는 전부 무효가 되므로 트리 루트도 NULL로 돌려야 함
+void resetPool(NodePool *pool)
+{
+	pool->current = pool->chunks;
+	pool->freeList = NULL;
+	pool->bumpIndex = pool->chunks != NULL ? 0 : POOL_CHUNK_NODES;
+	pool->liveNodes = 0;
+}
+
+// 슬랩까지 운영체제에 돌려줌 - O(chunks), 노드는 방문하지 않음
+void destroyPool(NodePool *pool)
+{
+	PoolChunk *chunk = pool->chunks;
+	PoolChunk *next;
+
+	while (chunk) {
+		next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+	initPool(pool);
+}
+
+// 노드 하나 할당
+// - free list에 재활용 노드가 있으면 그것부터 사용
+// - 없으면 현재 슬랩에서 bump 할당, 다 찼으면 다음 슬랩(reset 후 재사용) 또는 새 슬랩
+BSTNode *allocNode(NodePool *pool)
+{
+	BSTNode *node;
+	PoolChunk *chunk;
+
+	if (pool->freeList) {
+		node = pool->freeList;
+		pool->freeList = node->right;
+	}
+	else {
+		if (pool->bumpIndex == POOL_CHUNK_NODES) {
+			if (pool->current != NULL && pool->current->next != NULL) {
+				pool->current = pool->current->next;
+			}
+			else {
+				chunk = malloc(sizeof(PoolChunk));
+				if (chunk == NULL)
+					exit(0);
+				chunk->next = NULL;
+				if (pool->current == NULL)
+					pool->chunks = chunk;
+				else
+					pool->current->next = chunk;
+				pool->current = chunk;
+				pool->chunkCount++;
+			}
+			pool->bumpIndex = 0;
+		}
+		node = &pool->current->nodes[pool->bumpIndex++];
+	}
+	pool->liveNodes++;
+	return node;
+}
+
+// 노드 하나 반납 - free list의 맨 앞에 끼워 넣기만 함
+void freeNode(NodePool *pool, BSTNode *node)
+{
+	node->right = pool->freeList;
+	pool->freeList = node;
+	pool->liveNodes--;
+}
+
+void printPoolStats(NodePool *pool)
+{
+	printf("Pool: %d chunk(s) of %d nodes, %d live node(s), %d KB reserved\n",
+		pool->chunkCount, POOL_CHUNK_NODES, pool->liveNodes,
+		(int)(pool->chunkCount * sizeof(PoolChunk) / 1024));
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 링크를 따라 내려가는 반복 삽입 - 정렬 입력으로 생긴 깊은 사슬에서도 스택을 쓰지 않음
+void insertBSTNode(NodePool *pool, BSTNode **node, int value)
+{
+	while (*node != NULL) {
+		if (value < (*node)->item)
+			node = &((*node)->left);
+		else if (value > (*node)->item)
+			node = &((*node)->right);
+		else
+			return;
+	}
+	*node = allocNode(pool);
+	(*node)->item = value;
+	(*node)->left = NULL;
+	(*node)->right = NULL;
+}
+
+void inOrderTraversal(BSTNode *node)
+{
+	if (node == NULL)
+		return;
+	inOrderTraversal(node->left);
+	printf("%d ", node->item);
+	inOrderTraversal(node->right);
+}
+
+// 풀을 다른 트리와 같이 쓰는 경우의 반납: removeAll과 같은 회전 방식으로
+// 노드를 하나씩 free list에 넣음 - O(n)이지만 free() 호출은 없음
+void releaseTree(NodePool *pool, BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			freeNode(pool, cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNodeMalloc(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertBSTNodeMalloc(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertBSTNodeMalloc(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+// 이전 버전의 재귀 해제 (벤치마크 비교용) - 깊이 n인 사슬에서는 스택 오버플로
+void removeAllRecursive(BSTNode **node)
+{
+	if (*node != NULL)
+	{
+		removeAllRecursive(&((*node)->left));
+		removeAllRecursive(&((*node)->right));
+		free(*node);
+		*node = NULL;
+	}
+}
+
+// 왼쪽 자식이 있으면 오른쪽으로 회전해서 끌어올리고, 없으면 해제하고 오른쪽으로 이동
+// - 재귀도 보조 스택도 없이 O(n), 한쪽으로 치우친 트리에서도 스택 오버플로가 없음
+void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void printRow(const char *name, double seconds, int n)
+{
+	printf("  %-30s %8.3f ms %8.2f ns/node\n", name, seconds * 1e3, seconds * 1e9 / n);
+}
+
+// 모양별 malloc 트리 (shape 0: 무작위, 1: 정렬 입력의 오른쪽 사슬, 2: 왼쪽 사슬)
+// - 사슬은 재귀 삽입이 넘치므로 직접 연결
+static BSTNode* buildMallocTree(const int *keys, int n, int shape)
+{
+	BSTNode *root = NULL, *node;
+	int i;
+
+	if (shape == 0) {
+		for (i = 0; i < n; i++)
+			insertBSTNodeMalloc(&root, keys[i]);
+		return root;
+	}
+	for (i = n - 1; i >= 0; i--) {
+		node = malloc(sizeof(BSTNode));
+		if (node == NULL)
+			exit(0);
+		node->item = shape == 1 ? i : n - 1 - i;
+		node->left = shape == 2 ? root : NULL;
+		node->right = shape == 1 ? root : NULL;
+		root = node;
+	}
+	return root;
+}
+
+static BSTNode* buildPoolTree(NodePool *pool, const int *keys, int n, int shape)
+{
+	BSTNode *root = NULL, *node;
+	int i;
+
+	if (shape == 0) {
+		for (i = 0; i < n; i++)
+			insertBSTNode(pool, &root, keys[i]);
+		return root;
+	}
+	for (i = n - 1; i >= 0; i--) {
+		node = allocNode(pool);
+		node->item = shape == 1 ? i : n - 1 - i;
+		node->left = shape == 2 ? root : NULL;
+		node->right = shape == 1 ? root : NULL;
+		root = node;
+	}
+	return root;
+}
+
+// 같은 키로 만든 트리를 네 가지 방식으로 해제하고 걸린 시간만 비교 (생성 시간은 제외)
+void benchmarkTeardown(int n)
+{
+	static const char *shapes[] = { "random", "sorted (right chain)", "reverse (left chain)" };
+	NodePool pool;
+	BSTNode *root;
+	clock_t start;
+	int *keys;
+	int shape, i, j, tmp;
+
+	if (n <= 0)
+		return;
+	keys = malloc(sizeof(int) * n);
+	if (keys == NULL)
+		return;
+	for (i = 0; i < n; i++)
+		keys[i] = i;
+	for (i = n - 1; i > 0; i--) {
+		j = rand() % (i + 1);
+		tmp = keys[i];
+		keys[i] = keys[j];
+		keys[j] = tmp;
+	}
+
+	initPool(&pool);
+	printf("n = %d:\n", n);
+	for (shape = 0; shape < 3; shape++) {
+		printf(" %s tree\n", shapes[shape]);
+
+		// 재귀 해제는 사슬에서 깊이가 n이므로 작은 n에서만 실행
+		if (shape == 0 || n <= 50000) {
+			root = buildMallocTree(keys, n, shape);
+			start = clock();
+			removeAllRecursive(&root);
+			printRow("removeAll (recursive)", elapsed(start), n);
+		}
+		else {
+			printf("  %-30s skipped (recursion depth %d)\n", "removeAll (recursive)", n);
+		}
+
+		root = buildMallocTree(keys, n, shape);
+		start = clock();
+		removeAll(&root);
+		printRow("removeAll (iterative)", elapsed(start), n);
+
+		root = buildPoolTree(&pool, keys, n, shape);
+		start = clock();
+		releaseTree(&pool, &root);
+		printRow("releaseTree (to free list)", elapsed(start), n);
+		if (pool.liveNodes != 0)
+			printf("  CHECK FAILED\n");
+
+		// free list에 쌓인 노드로 다시 만든 뒤 풀째로 반납
+		root = buildPoolTree(&pool, keys, n, shape);
+		start = clock();
+		resetPool(&pool);
+		root = NULL;
+		printRow("resetPool (O(1))", elapsed(start), n);
+
+		root = buildPoolTree(&pool, keys, n, shape);
+		start = clock();
+		destroyPool(&pool);
+		root = NULL;
+		printRow("destroyPool (O(chunks))", elapsed(start), n);
+	}
+
+	free(keys);
+}
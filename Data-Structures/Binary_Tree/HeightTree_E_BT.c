@@ -0,0 +1,552 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section E - Binary Trees
+Purpose: Binary tree whose nodes cache their subtree height, size and number of
+         unbalanced nodes, updated on every insert/remove, so that maxHeight(),
+         balance queries and hasGreatGrandchild() no longer recompute depths */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// height uses Q2's convention (an empty tree is -1, a single node is 0).
+// unbalanced counts the nodes in this subtree whose child heights differ by more than one.
+typedef struct _heightbtnode{
+    int item;
+    int height;
+    int size;
+    int unbalanced;
+    struct _heightbtnode *parent;
+    struct _heightbtnode *left;
+    struct _heightbtnode *right;
+} HeightBTNode;
+
+typedef struct _stackNode{
+    HeightBTNode *btnode;
+    struct _stackNode *next;
+}StackNode;
+
+typedef struct _stack{
+    StackNode *top;
+}Stack;
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+int maxHeight(HeightBTNode *node);
+int subtreeSize(HeightBTNode *node);
+int balanceFactor(HeightBTNode *node);
+int isHeightBalanced(HeightBTNode *node);
+int hasGreatGrandchild(HeightBTNode *node);
+
+HeightBTNode* createBTNode(int item);
+HeightBTNode* replaceChild(HeightBTNode *parent, int right, HeightBTNode *child);
+HeightBTNode* detachSubtree(HeightBTNode **root, HeightBTNode *node);
+HeightBTNode* findNode(HeightBTNode *node, int item);
+
+HeightBTNode* createTree();
+void push( Stack *stk, HeightBTNode *node);
+HeightBTNode* pop(Stack *stk);
+
+void printTree(HeightBTNode *node);
+void removeAll(HeightBTNode **node);
+
+void benchmarkQueries(int n, int rounds);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+    int c, i, j, k;
+    char e;
+    HeightBTNode *root, *node;
+
+    root = NULL;
+    c = 1;
+
+    printf("1: Create a binary tree.\n");
+    printf("2: Print the height and the size of the tree.\n");
+    printf("3: Check the balance of the tree.\n");
+    printf("4: Find the great grandchildren of the binary tree.\n");
+    printf("5: Add a child to a node.\n");
+    printf("6: Remove the subtree rooted at a value.\n");
+    printf("7: Run the cached vs recomputed query benchmark.\n");
+    printf("0: Quit;\n");
+
+    while(c != 0){
+        printf("Please input your choice(1-7/0): ");
+        if(scanf("%d", &c) > 0)
+        {
+            switch(c)
+            {
+            case 1:
+                removeAll(&root);
+                root = createTree();
+                printf("The resulting binary tree is: ");
+                printTree(root);
+                printf("\n");
+                break;
+            case 2:
+                printf("The maximum height of the binary tree is: %d\n", maxHeight(root));
+                printf("The number of nodes in the binary tree is: %d\n", subtreeSize(root));
+                break;
+            case 3:
+                printf("The balance factor of the root is: %d\n", balanceFactor(root));
+                if (isHeightBalanced(root))
+                    printf("Every node of the tree is height-balanced.\n");
+                else
+                    printf("%d node(s) of the tree are not height-balanced.\n", root->unbalanced);
+                break;
+            case 4:
+                printf("The values stored in all nodes of the tree that has at least one great-grandchild are: ");
+                hasGreatGrandchild(root);
+                printf("\n");
+                break;
+            case 5:
+                printf("Input the parent value, the side (0: left, 1: right) and the new value: ");
+                scanf("%d %d %d", &i, &j, &k);
+                node = findNode(root, i);
+                if (node == NULL)
+                    printf("%d is not in the tree\n", i);
+                else if ((j ? node->right : node->left) != NULL)
+                    printf("%d already has that child\n", i);
+                else
+                    replaceChild(node, j, createBTNode(k));
+                printf("The resulting binary tree is: ");
+                printTree(root);
+                printf("\n");
+                break;
+            case 6:
+                printf("Input the value to remove: ");
+                scanf("%d", &i);
+                node = findNode(root, i);
+                if (node == NULL)
+                    printf("%d is not in the tree\n", i);
+                else {
+                    node = detachSubtree(&root, node);
+                    removeAll(&node);
+                }
+                printf("The resulting binary tree is: ");
+                printTree(root);
+                printf("\n");
+                break;
+            case 7:
+                printf("Input the number of nodes and the number of rounds: ");
+                scanf("%d %d", &i, &j);
+                benchmarkQueries(i, j);
+                break;
+            case 0:
+                removeAll(&root);
+                break;
+            default:
+                printf("Choice unknown;\n");
+                break;
+            }
+        }
+        else
+        {
+            scanf("%c",&e);
+        }
+
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 모두 캐시된 값을 읽기만 하므로 O(1)
+int maxHeight(HeightBTNode *node)
+{
+    return node == NULL ? -1 : node->height;
+}
+
+int subtreeSize(HeightBTNode *node)
+{
+    return node == NULL ? 0 : node->size;
+}
+
+int balanceFactor(HeightBTNode *node)
+{
+    if (node == NULL)
+        return 0;
+    return maxHeight(node->left) - maxHeight(node->right);
+}
+
+int isHeightBalanced(HeightBTNode *node)
+{
+    return node == NULL || node->unbalanced == 0;
+}
+
+// 높이가 3 이상이면 증손자가 있음, 높이가 3 미만인 노드의 자손도 모두 3 미만이므로
+// 그런 서브트리는 내려가지 않음 - 출력할 노드만 방문하는 O(출력)
+// Q8과 같은 후위 순서로 출력하고 출력한 노드 수를 반환
+static int greatGrandparents(HeightBTNode *node, int print)
+{
+    int count;
+
+    if (node == NULL || node->height < 3)
+        return 0;
+    count = greatGrandparents(node->left, print);
+    count += greatGrandparents(node->right, print);
+    if (print)
+        printf("%d ", node->item);
+    return count + 1;
+}
+
+int hasGreatGrandchild(HeightBTNode *node)
+{
+    return greatGrandparents(node, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 자식의 캐시로 node의 값을 다시 계산하고 바뀐 것이 있으면 1
+static int updateNode(HeightBTNode *node)
+{
+    int lh = maxHeight(node->left), rh = maxHeight(node->right);
+    int height = 1 + (lh > rh ? lh : rh);
+    int size = 1 + subtreeSize(node->left) + subtreeSize(node->right);
+    int unbalanced = (lh - rh > 1 || rh - lh > 1)
+        + (node->left ? node->left->unbalanced : 0) + (node->right ? node->right->unbalanced : 0);
+
+    if (height == node->height && size == node->size && unbalanced == node->unbalanced)
+        return 0;
+    node->height = height;
+    node->size = size;
+    node->unbalanced = unbalanced;
+    return 1;
+}
+
+// node부터 루트까지 갱신 - O(깊이), 바뀐 것이 없으면 위쪽도 그대로이므로 멈춤
+static void updateUp(HeightBTNode *node)
+{
+    while (node != NULL && updateNode(node))
+        node = node->parent;
+}
+
+HeightBTNode *createBTNode(int item){
+    HeightBTNode *newNode = malloc(sizeof(HeightBTNode));
+    if (newNode == NULL)
+        exit(0);
+    newNode->item = item;
+    newNode->height = 0;
+    newNode->size = 1;
+    newNode->unbalanced = 0;
+    newNode->parent = NULL;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    return newNode;
+}
+
+// Hangs child (which must not already have a parent) under parent as its
+// left (right == 0) or right child and returns the subtree it replaced,
+// detached, so that the caller can keep it or pass it to removeAll()
+HeightBTNode* replaceChild(HeightBTNode *parent, int right, HeightBTNode *child)
+{
+    HeightBTNode **link = right ? &parent->right : &parent->left;
+    HeightBTNode *old = *link;
+
+    if (old != NULL)
+        old->parent = NULL;
+    *link = child;
+    if (child != NULL)
+        child->parent = parent;
+    updateUp(parent);
+    return old;
+}
+
+// Unlinks the subtree rooted at node from the tree at *root and returns it
+HeightBTNode* detachSubtree(HeightBTNode **root, HeightBTNode *node)
+{
+    if (node->parent == NULL) {
+        if (*root == node)
+            *root = NULL;
+        return node;
+    }
+    return replaceChild(node->parent, node->parent->right == node, NULL);
+}
+
+// 전위 순서로 item을 가진 첫 노드
+HeightBTNode* findNode(HeightBTNode *node, int item)
+{
+    HeightBTNode *found;
+
+    if (node == NULL || node->item == item)
+        return node;
+    found = findNode(node->left, item);
+    if (found != NULL)
+        return found;
+    return findNode(node->right, item);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// Q2_E_BT.c와 같은 입력 순서, 자식을 붙일 때마다 replaceChild()로 캐시를 맞춤
+HeightBTNode *createTree()
+{
+    Stack stk;
+    HeightBTNode *root, *temp;
+    char s;
+    int item;
+
+    stk.top = NULL;
+    root = NULL;
+
+    printf("Input an integer that you want to add to the binary tree. Any Alpha value will be treated as NULL.\n");
+    printf("Enter an integer value for the root: ");
+    if(scanf("%d",&item) > 0)
+    {
+        root = createBTNode(item);
+        push(&stk,root);
+    }
+    else
+    {
+        scanf("%c",&s);
+    }
+
+    while((temp =pop(&stk)) != NULL)
+    {
+
+        printf("Enter an integer value for the Left child of %d: ", temp->item);
+
+        if(scanf("%d",&item)> 0)
+        {
+            replaceChild(temp, 0, createBTNode(item));
+        }
+        else
+        {
+            scanf("%c",&s);
+        }
+
+        printf("Enter an integer value for the Right child of %d: ", temp->item);
+        if(scanf("%d",&item)>0)
+        {
+            replaceChild(temp, 1, createBTNode(item));
+        }
+        else
+        {
+            scanf("%c",&s);
+        }
+
+        if(temp->right != NULL)
+            push(&stk,temp->right);
+        if(temp->left != NULL)
+            push(&stk,temp->left);
+    }
+    return root;
+}
+
+void push( Stack *stk, HeightBTNode *node){
+    StackNode *temp;
+
+    temp = malloc(sizeof(StackNode));
+    if(temp == NULL)
+        return;
+    temp->btnode = node;
+    if(stk->top == NULL){
+        stk->top = temp;
+        temp->next = NULL;
+    }
+    else{
+        temp->next = stk->top;
+        stk->top = temp;
+    }
+}
+
+HeightBTNode* pop(Stack *stk){
+   StackNode *temp, *top;
+   HeightBTNode *ptr;
+   ptr = NULL;
+
+   top = stk->top;
+   if(top != NULL){
+        temp = top->next;
+        ptr = top->btnode;
+
+        stk->top = temp;
+        free(top);
+        top = NULL;
+   }
+   return ptr;
+}
+
+void printTree(HeightBTNode *node){
+    if(node == NULL) return;
+
+    printTree(node->left);
+    printf("%d ",node->item);
+    printTree(node->right);
+}
+
+void removeAll(HeightBTNode **node){
+    HeightBTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
+    }
+    *node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 캐시 없이 매번 다시 계산하는 버전 (Q2의 maxHeight, Q8의 hasGreatGrandchild 방식)
+static int recomputeHeight(HeightBTNode *node)
+{
+    int lh, rh;
+
+    if (node == NULL)
+        return -1;
+    lh = recomputeHeight(node->left);
+    rh = recomputeHeight(node->right);
+    return 1 + (lh > rh ? lh : rh);
+}
+
+// 높이를 반환하고 균형이 깨진 노드 수를 *unbalanced에 더함
+static int recomputeBalance(HeightBTNode *node, int *unbalanced)
+{
+    int lh, rh;
+
+    if (node == NULL)
+        return -1;
+    lh = recomputeBalance(node->left, unbalanced);
+    rh = recomputeBalance(node->right, unbalanced);
+    if (lh - rh > 1 || rh - lh > 1)
+        (*unbalanced)++;
+    return 1 + (lh > rh ? lh : rh);
+}
+
+// 높이를 반환하고 증손자가 있는 노드 수를 *count에 더함
+static int recomputeGreatGrandparents(HeightBTNode *node, int *count)
+{
+    int lh, rh;
+
+    if (node == NULL)
+        return -1;
+    lh = recomputeGreatGrandparents(node->left, count);
+    rh = recomputeGreatGrandparents(node->right, count);
+    if (lh >= 2 || rh >= 2)
+        (*count)++;
+    return 1 + (lh > rh ? lh : rh);
+}
+
+static double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static unsigned int fmix32(unsigned int h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// 무작위 모양의 트리: 새 노드를 루트에서 무작위 방향으로 내려가 빈 자리에 붙임
+// (깊이는 약 log n에서 2 log n 정도로 무작위 BST보다 약간 깊음)
+static HeightBTNode* buildRandomTree(int n, HeightBTNode **nodes)
+{
+    HeightBTNode *root, *cur;
+    unsigned int bits = 0;
+    int i, step = 32, dir;
+
+    root = nodes[0] = createBTNode((int)(fmix32(1) % 1000));
+    for (i = 1; i < n; i++) {
+        nodes[i] = createBTNode((int)(fmix32(i * 2 + 1) % 1000));
+        cur = root;
+        for (;;) {
+            if (step == 32) {
+                bits = fmix32(i * 40503u + bits);
+                step = 0;
+            }
+            dir = (bits >> step++) & 1;
+            if ((dir ? cur->right : cur->left) == NULL)
+                break;
+            cur = dir ? cur->right : cur->left;
+        }
+        replaceChild(cur, dir, nodes[i]);
+    }
+    return root;
+}
+
+// 매 라운드 잎 하나를 떼었다가 다시 붙이고, 그때마다 세 가지 질의를 함
+// - 캐시 버전과 다시 계산하는 버전의 결과가 같은지도 확인
+void benchmarkQueries(int n, int rounds)
+{
+    HeightBTNode **nodes, *root, *node = NULL, *parent = NULL;
+    clock_t start;
+    double seconds[2], mutateTime = 0;
+    long long checks[2];
+    int method, r, side = 0, unbalanced, count, height;
+
+    if (n < 2 || rounds <= 0)
+        return;
+    nodes = malloc(sizeof(HeightBTNode*) * n);
+    if (nodes == NULL)
+        return;
+    start = clock();
+    root = buildRandomTree(n, nodes);
+    printf("n = %d, height %d, %d great-grandparents, built in %.3f s\n", n, maxHeight(root),
+        greatGrandparents(root, 0), elapsed(start));
+
+    for (method = 0; method < 2; method++) {
+        checks[method] = 0;
+        seconds[method] = 0;
+        for (r = 0; r < 2 * rounds; r++) {
+            // 짝수 라운드는 잎을 떼고, 홀수 라운드는 같은 자리에 다시 붙임
+            start = clock();
+            if (r % 2 == 0) {
+                node = nodes[1 + fmix32(r / 2 + 11) % (n - 1)];
+                while (node->left != NULL || node->right != NULL)
+                    node = node->left != NULL ? node->left : node->right;
+                parent = node->parent;
+                side = parent->right == node;
+                detachSubtree(&root, node);
+            }
+            else
+                replaceChild(parent, side, node);
+            mutateTime += elapsed(start);
+
+            start = clock();
+            if (method == 0) {
+                unbalanced = 0;
+                count = 0;
+                height = recomputeHeight(root);
+                recomputeBalance(root, &unbalanced);
+                recomputeGreatGrandparents(root, &count);
+            }
+            else {
+                height = maxHeight(root);
+                unbalanced = root->unbalanced;
+                count = greatGrandparents(root, 0);
+            }
+            seconds[method] += elapsed(start);
+            checks[method] += height * 1000003LL + unbalanced * 1009LL + count;
+        }
+    }
+    printf("  recomputed queries: %12.1f us per round (height + balance + great-grandchildren)\n",
+        seconds[0] * 1e6 / (2.0 * rounds));
+    printf("  cached queries:     %12.1f us per round\n", seconds[1] * 1e6 / (2.0 * rounds));
+    printf("  cached maxHeight/balance alone are O(1); hasGreatGrandchild visits only its output\n");
+    printf("  leaf remove/insert with cache update: %.1f ns\n", mutateTime * 1e9 / (4.0 * rounds));
+    if (checks[0] != checks[1] || recomputeHeight(root) != maxHeight(root))
+        printf("  (CHECK FAILED)\n");
+
+    removeAll(&root);
+    free(nodes);
+}
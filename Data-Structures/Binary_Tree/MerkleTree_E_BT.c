@@ -0,0 +1,537 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section E - Binary Trees
+Purpose: Binary tree whose nodes carry a Merkle hash of their subtree, kept up
+         to date on every mutation, so that identical() rejects different trees
+         in O(1) and accepts equal subtrees without descending into them */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MERKLE_TRUST_HASH 1     // 0: confirm every hash match by comparing the nodes
+#define NULL_HASH 0x5bd1e9955bd1e995ULL
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// hash covers item and the shape and items of both subtrees, so two subtrees
+// with different hashes are certainly different. Equal hashes mean equal
+// subtrees unless two 64-bit hashes collide (about 2^-64 per comparison).
+typedef struct _hashbtnode{
+    int item;
+    uint64_t hash;
+    struct _hashbtnode *parent;
+    struct _hashbtnode *left;
+    struct _hashbtnode *right;
+} HashBTNode;
+
+typedef struct _stackNode{
+    HashBTNode *btnode;
+    struct _stackNode *next;
+}StackNode;
+
+typedef struct _stack{
+    StackNode *top;
+}Stack;
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+int identical(HashBTNode *tree1, HashBTNode *tree2);
+int identicalNoHash(HashBTNode *tree1, HashBTNode *tree2);
+
+HashBTNode* createBTNode(int item);
+void setItem(HashBTNode *node, int item);
+HashBTNode* replaceChild(HashBTNode *parent, int right, HashBTNode *child);
+HashBTNode* copyTree(HashBTNode *node);
+HashBTNode* findNode(HashBTNode *node, int item);
+
+HashBTNode* createTree();
+void push( Stack *stk, HashBTNode *node);
+HashBTNode* pop(Stack *stk);
+
+void printTree(HashBTNode *node);
+void removeAll(HashBTNode **node);
+
+void benchmarkIdentical(int n, int rounds);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+    int c, s, i, j;
+    char e;
+    HashBTNode *root1, *root2, *node;
+
+    root1 = NULL;
+    root2 = NULL;
+    c = 1;
+
+    printf("1: Create a binary tree1.\n");
+    printf("2: Create a binary tree2.\n");
+    printf("3: Check whether two trees are structurally identical.\n");
+    printf("4: Copy tree1 into tree2.\n");
+    printf("5: Change a value in tree2.\n");
+    printf("6: Run the hashed vs recursive identical() benchmark.\n");
+    printf("0: Quit;\n");
+
+    while(c != 0){
+        printf("Please input your choice(1-6/0): ");
+        if(scanf("%d", &c) > 0)
+        {
+            switch(c)
+            {
+            case 1:
+                removeAll(&root1);
+                printf("Creating tree1:\n");
+                root1 = createTree();
+                printf("The resulting tree1 is: ");
+                printTree(root1);
+                printf("\n");
+                break;
+            case 2:
+                removeAll(&root2);
+                printf("Creating tree2:\n");
+                root2 = createTree();
+                printf("The resulting tree2 is: ");
+                printTree(root2);
+                printf("\n");
+                break;
+            case 3:
+                s = identical(root1, root2);
+                if(s){
+                printf("Both trees are structurally identical.\n");
+                }
+                else{
+                printf("Both trees are different.\n");
+                }
+                break;
+            case 4:
+                removeAll(&root2);
+                root2 = copyTree(root1);
+                printf("The resulting tree2 is: ");
+                printTree(root2);
+                printf("\n");
+                break;
+            case 5:
+                printf("Input the value to change and its new value: ");
+                scanf("%d %d", &i, &j);
+                node = findNode(root2, i);
+                if (node == NULL)
+                    printf("%d is not in tree2\n", i);
+                else
+                    setItem(node, j);
+                printf("The resulting tree2 is: ");
+                printTree(root2);
+                printf("\n");
+                break;
+            case 6:
+                printf("Input the number of nodes and the number of rounds: ");
+                scanf("%d %d", &i, &j);
+                benchmarkIdentical(i, j);
+                break;
+            case 0:
+                removeAll(&root1);
+                removeAll(&root2);
+                break;
+            default:
+                printf("Choice unknown;\n");
+                break;
+            }
+        }
+        else
+        {
+            scanf("%c",&e);
+        }
+
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 해시가 다르면 바로 다른 트리, 같으면 그 서브트리는 내려가지 않고 같다고 판단
+// - 스냅숏끼리 서브트리를 공유하면 포인터가 같으므로 그것도 바로 같음
+int identical(HashBTNode *tree1, HashBTNode *tree2)
+{
+    if (tree1 == tree2)
+        return 1;
+    if (tree1 == NULL || tree2 == NULL || tree1->hash != tree2->hash)
+        return 0;
+#if MERKLE_TRUST_HASH
+    return 1;
+#else
+    return tree1->item == tree2->item && identical(tree1->left, tree2->left)
+        && identical(tree1->right, tree2->right);
+#endif
+}
+
+// Q1_E_BT.c의 identical()과 같은 전체 비교 (벤치마크 비교용)
+int identicalNoHash(HashBTNode *tree1, HashBTNode *tree2)
+{
+    if (tree1 == NULL && tree2 == NULL)
+        return 1;
+    if (tree1 == NULL || tree2 == NULL || tree1->item != tree2->item)
+        return 0;
+    return identicalNoHash(tree1->left, tree2->left) && identicalNoHash(tree1->right, tree2->right);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static uint64_t fmix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// 왼쪽/오른쪽에 서로 다른 곱셈과 회전을 써서 좌우를 바꾼 트리도 다른 해시가 되게 함
+static uint64_t nodeHash(HashBTNode *node)
+{
+    uint64_t left = node->left ? node->left->hash : NULL_HASH;
+    uint64_t right = node->right ? node->right->hash : NULL_HASH;
+    uint64_t h = fmix64((uint64_t)(uint32_t)node->item + 0x9e3779b97f4a7c15ULL);
+
+    h ^= left * 0xc2b2ae3d27d4eb4fULL;
+    h = (h << 31) | (h >> 33);
+    h ^= right * 0x165667b19e3779f9ULL;
+    return fmix64(h);
+}
+
+// node부터 루트까지 해시를 다시 계산 - O(깊이)
+// - 새 해시가 예전과 같으면 위쪽도 그대로이므로 멈춤
+static void rehashUp(HashBTNode *node)
+{
+    uint64_t h;
+
+    while (node != NULL) {
+        h = nodeHash(node);
+        if (h == node->hash)
+            return;
+        node->hash = h;
+        node = node->parent;
+    }
+}
+
+HashBTNode *createBTNode(int item){
+    HashBTNode *newNode = malloc(sizeof(HashBTNode));
+    if (newNode == NULL)
+        exit(0);
+    newNode->item = item;
+    newNode->parent = NULL;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    newNode->hash = 0;
+    newNode->hash = nodeHash(newNode);
+    return newNode;
+}
+
+void setItem(HashBTNode *node, int item)
+{
+    node->item = item;
+    rehashUp(node);
+}
+
+// Hangs child (which must not already have a parent) under parent as its
+// left (right == 0) or right child and returns the subtree it replaced,
+// detached, so that the caller can keep it or pass it to removeAll()
+HashBTNode* replaceChild(HashBTNode *parent, int right, HashBTNode *child)
+{
+    HashBTNode **link = right ? &parent->right : &parent->left;
+    HashBTNode *old = *link;
+
+    if (old != NULL)
+        old->parent = NULL;
+    *link = child;
+    if (child != NULL)
+        child->parent = parent;
+    rehashUp(parent);
+    return old;
+}
+
+// 스냅숏: 해시는 그대로 복사하므로 다시 계산하지 않음
+HashBTNode* copyTree(HashBTNode *node)
+{
+    HashBTNode *copy;
+
+    if (node == NULL)
+        return NULL;
+    copy = malloc(sizeof(HashBTNode));
+    if (copy == NULL)
+        exit(0);
+    copy->item = node->item;
+    copy->hash = node->hash;
+    copy->parent = NULL;
+    copy->left = copyTree(node->left);
+    copy->right = copyTree(node->right);
+    if (copy->left != NULL)
+        copy->left->parent = copy;
+    if (copy->right != NULL)
+        copy->right->parent = copy;
+    return copy;
+}
+
+// 전위 순서로 item을 가진 첫 노드
+HashBTNode* findNode(HashBTNode *node, int item)
+{
+    HashBTNode *found;
+
+    if (node == NULL || node->item == item)
+        return node;
+    found = findNode(node->left, item);
+    if (found != NULL)
+        return found;
+    return findNode(node->right, item);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// Q1_E_BT.c와 같은 입력 순서, 자식을 붙일 때마다 replaceChild()로 해시를 맞춤
+HashBTNode *createTree()
+{
+    Stack stk;
+    HashBTNode *root, *temp;
+    char s;
+    int item;
+
+    stk.top = NULL;
+    root = NULL;
+
+    printf("Input an integer that you want to add to the binary tree. Any Alpha value will be treated as NULL.\n");
+    printf("Enter an integer value for the root: ");
+    if(scanf("%d",&item) > 0)
+    {
+        root = createBTNode(item);
+        push(&stk,root);
+    }
+    else
+    {
+        scanf("%c",&s);
+    }
+
+    while((temp =pop(&stk)) != NULL)
+    {
+
+        printf("Enter an integer value for the Left child of %d: ", temp->item);
+
+        if(scanf("%d",&item)> 0)
+        {
+            replaceChild(temp, 0, createBTNode(item));
+        }
+        else
+        {
+            scanf("%c",&s);
+        }
+
+        printf("Enter an integer value for the Right child of %d: ", temp->item);
+        if(scanf("%d",&item)>0)
+        {
+            replaceChild(temp, 1, createBTNode(item));
+        }
+        else
+        {
+            scanf("%c",&s);
+        }
+
+        if(temp->right != NULL)
+            push(&stk,temp->right);
+        if(temp->left != NULL)
+            push(&stk,temp->left);
+    }
+    return root;
+}
+
+void push( Stack *stk, HashBTNode *node){
+    StackNode *temp;
+
+    temp = malloc(sizeof(StackNode));
+    if(temp == NULL)
+        return;
+    temp->btnode = node;
+    if(stk->top == NULL){
+        stk->top = temp;
+        temp->next = NULL;
+    }
+    else{
+        temp->next = stk->top;
+        stk->top = temp;
+    }
+}
+
+HashBTNode* pop(Stack *stk){
+   StackNode *temp, *top;
+   HashBTNode *ptr;
+   ptr = NULL;
+
+   top = stk->top;
+   if(top != NULL){
+        temp = top->next;
+        ptr = top->btnode;
+
+        stk->top = temp;
+        free(top);
+        top = NULL;
+   }
+   return ptr;
+}
+
+void printTree(HashBTNode *node){
+    if(node == NULL) return;
+
+    printTree(node->left);
+    printf("%d ",node->item);
+    printTree(node->right);
+}
+
+void removeAll(HashBTNode **node){
+    HashBTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
+    }
+    *node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static unsigned int fmix32(unsigned int h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// 무작위 모양의 트리: i번째 노드를 무작위 키 순서의 BST 자리에 붙임 (깊이 약 2 ln n)
+static HashBTNode* buildRandomTree(int n, HashBTNode **nodes)
+{
+    HashBTNode *root = NULL, *cur;
+    unsigned int key;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        nodes[i] = createBTNode((int)(fmix32(i * 2 + 1) % 1000000));
+        nodes[i]->hash = fmix32(i + 1);    // 모양을 정할 임시 키
+        if (root == NULL) {
+            root = nodes[i];
+            continue;
+        }
+        key = (unsigned int)nodes[i]->hash;
+        cur = root;
+        for (;;) {
+            if (key < (unsigned int)cur->hash) {
+                if (cur->left == NULL) {
+                    cur->left = nodes[i];
+                    break;
+                }
+                cur = cur->left;
+            }
+            else {
+                if (cur->right == NULL) {
+                    cur->right = nodes[i];
+                    break;
+                }
+                cur = cur->right;
+            }
+        }
+        nodes[i]->parent = cur;
+    }
+    return root;
+}
+
+// 자식부터 해시를 한 번에 계산 - O(n)
+static void hashAll(HashBTNode *node)
+{
+    if (node == NULL)
+        return;
+    hashAll(node->left);
+    hashAll(node->right);
+    node->hash = nodeHash(node);
+}
+
+static void collectNodes(HashBTNode *node, HashBTNode **nodes, int *count)
+{
+    if (node == NULL)
+        return;
+    nodes[(*count)++] = node;
+    collectNodes(node->left, nodes, count);
+    collectNodes(node->right, nodes, count);
+}
+
+// 스냅숏 두 개를 만들고 매 라운드 사본의 무작위 노드 하나를 바꿨다가 되돌리며 비교
+// - 바꾼 직후는 거의 같은 두 트리(다름), 되돌린 뒤는 같은 두 트리
+void benchmarkIdentical(int n, int rounds)
+{
+    HashBTNode **nodes, *tree1, *tree2, *node;
+    clock_t start;
+    double seconds[2], mutateTime = 0;
+    long long results[2];
+    int method, r, count, old;
+
+    if (n <= 0 || rounds <= 0)
+        return;
+    nodes = malloc(sizeof(HashBTNode*) * n);
+    if (nodes == NULL)
+        return;
+    tree1 = buildRandomTree(n, nodes);
+    hashAll(tree1);
+    tree2 = copyTree(tree1);
+    count = 0;
+    collectNodes(tree2, nodes, &count);
+
+    printf("n = %d, %d rounds of change + compare + restore + compare:\n", n, rounds);
+    for (method = 0; method < 2; method++) {
+        results[method] = 0;
+        seconds[method] = 0;
+        for (r = 0; r < rounds; r++) {
+            node = nodes[fmix32(r + 7) % n];
+            old = node->item;
+
+            start = clock();
+            setItem(node, old + 1);
+            mutateTime += elapsed(start);
+            start = clock();
+            results[method] += (method == 0 ? identicalNoHash(tree1, tree2) : identical(tree1, tree2)) * 2;
+            seconds[method] += elapsed(start);
+
+            start = clock();
+            setItem(node, old);
+            mutateTime += elapsed(start);
+            start = clock();
+            results[method] += method == 0 ? identicalNoHash(tree1, tree2) : identical(tree1, tree2);
+            seconds[method] += elapsed(start);
+        }
+    }
+    printf("  identical() recursive: %12.1f ns per compare\n", seconds[0] * 1e9 / (2.0 * rounds));
+    printf("  identical() hashed:    %12.1f ns per compare\n", seconds[1] * 1e9 / (2.0 * rounds));
+    printf("  setItem() with rehash: %12.1f ns per change\n", mutateTime * 1e9 / (4.0 * rounds));
+    // 바꾼 직후는 항상 다르고(0) 되돌린 뒤는 항상 같아야(1) 함
+    if (results[0] != rounds || results[1] != rounds)
+        printf("  (CHECK FAILED)\n");
+
+    removeAll(&tree1);
+    removeAll(&tree2);
+    free(nodes);
+}
@@ -0,0 +1,751 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section E - Binary Trees
+Purpose: Fork-join tree reductions on a work-stealing thread pool, with
+         countOneChildNodes() (Q3), sumOfOddNodes() (Q4) and smallestValue() (Q7)
+         ported to it, and a 1-16 thread strong-scaling benchmark.
+         Build with: gcc -O2 -pthread */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define MAX_THREADS 16
+#define DEQUE_SIZE 64       // tasks are only offered while a deque is nearly empty
+#define DEQUE_LOW 2
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _btnode
+{
+    int item;
+    struct _btnode *left;
+    struct _btnode *right;
+} BTNode;   // You should not change the definition of BTNode
+
+typedef struct _stackNode
+{
+    BTNode *btnode;
+    struct _stackNode *next;
+} StackNode;
+
+typedef struct _stack
+{
+    StackNode *top;
+} Stack;
+
+// A reduction maps every node to a value and folds the values with combine,
+// starting from identity. combine must be associative and commutative: each
+// worker folds whatever subtrees it happens to run, in any order, and the
+// per-worker results are folded together at the end.
+typedef struct _reduceop{
+    long long identity;
+    long long (*map)(BTNode *node);
+    long long (*combine)(long long a, long long b);
+} ReduceOp;
+
+// Owner pushes and pops at bottom, thieves take the oldest task at top
+typedef struct _deque{
+    atomic_int lock;
+    int top;
+    int bottom;
+    BTNode *tasks[DEQUE_SIZE];       // reset to 0 whenever the deque drains
+} Deque;
+
+struct _reducepool;
+
+typedef struct _poolworker{
+    struct _reducepool *pool;
+    int id;
+    unsigned int rng;
+    Deque deque;
+    BTNode **stack;         // pending subtrees of the running task, oldest at base
+    int stackCap;
+    long long partial;
+    pthread_t tid;
+} PoolWorker;
+
+// Worker 0 is the calling thread; workers 1..threads-1 sleep between jobs
+typedef struct _reducepool{
+    int threads;
+    int cutoff;             // nodes a task visits before offering its pending subtrees
+    PoolWorker workers[MAX_THREADS];
+    const ReduceOp *op;
+    atomic_int pending;     // tasks pushed but not yet finished
+    atomic_int finished;    // helper workers done with the current job
+    pthread_mutex_t mutex;
+    pthread_cond_t start;
+    int generation;
+    int shutdown;
+} ReducePool;
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+void initPool(ReducePool *pool, int threads, int cutoff);
+void destroyPool(ReducePool *pool);
+long long parallelReduce(ReducePool *pool, BTNode *root, const ReduceOp *op);
+
+int countOneChildNodes(ReducePool *pool, BTNode *node);
+int sumOfOddNodes(ReducePool *pool, BTNode *root);
+int smallestValue(ReducePool *pool, BTNode *node);
+
+BTNode *createBTNode(int item);
+
+BTNode *createTree();
+void push( Stack *stack, BTNode *node);
+BTNode* pop(Stack *stack);
+
+void printTree(BTNode *node);
+void removeAll(BTNode **node);
+
+void benchmarkScaling(int n, int cutoff);
+
+///////////////////////////// main() /////////////////////////////////////////////
+
+int main()
+{
+    char e;
+    int c, i, j;
+    BTNode *root;
+    ReducePool pool;
+
+    c = 1;
+    root = NULL;
+    initPool(&pool, 4, 4096);
+
+    printf("1: Create a binary tree.\n");
+    printf("2: Count the number of nodes that have exactly one child node.\n");
+    printf("3: Find the sum of all odd numbers in the binary tree.\n");
+    printf("4: Smallest value;\n");
+    printf("5: Set the number of threads and the cutoff.\n");
+    printf("6: Run the strong-scaling benchmark.\n");
+    printf("0: Quit;\n");
+
+    while(c != 0)
+    {
+        printf("Please input your choice(1-6/0): ");
+        if( scanf("%d",&c) > 0)
+        {
+            switch(c)
+            {
+            case 1:
+                removeAll(&root);
+                root = createTree();
+                printf("The resulting binary tree is: ");
+                printTree(root);
+                printf("\n");
+                break;
+            case 2:
+                printf("The number of nodes that have exactly one child node is: %d.\n", countOneChildNodes(&pool, root));
+                break;
+            case 3:
+                printf("The sum of all odd numbers in the binary tree is: %d.\n", sumOfOddNodes(&pool, root));
+                break;
+            case 4:
+                printf("Smallest value of the binary tree is: %d\n", smallestValue(&pool, root));
+                break;
+            case 5:
+                printf("Input the number of threads (1-%d) and the cutoff: ", MAX_THREADS);
+                scanf("%d %d", &i, &j);
+                destroyPool(&pool);
+                initPool(&pool, i, j);
+                printf("Using %d thread(s), cutoff %d\n", pool.threads, pool.cutoff);
+                break;
+            case 6:
+                printf("Input the number of nodes and the cutoff: ");
+                scanf("%d %d", &i, &j);
+                benchmarkScaling(i, j);
+                break;
+            case 0:
+                removeAll(&root);
+                destroyPool(&pool);
+                break;
+            default:
+                printf("Choice unknown;\n");
+                break;
+            }
+        }
+        else
+        {
+            scanf("%c",&e);
+        }
+
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static long long mapOneChild(BTNode *node)
+{
+    return (node->left == NULL) != (node->right == NULL);
+}
+
+static long long mapOdd(BTNode *node)
+{
+    return node->item % 2 == 1 ? node->item : 0;
+}
+
+static long long mapItem(BTNode *node)
+{
+    return node->item;
+}
+
+static long long combineSum(long long a, long long b)
+{
+    return a + b;
+}
+
+static long long combineMin(long long a, long long b)
+{
+    return a < b ? a : b;
+}
+
+static const ReduceOp oneChildOp = { 0, mapOneChild, combineSum };
+static const ReduceOp oddSumOp = { 0, mapOdd, combineSum };
+static const ReduceOp minOp = { INT_MAX, mapItem, combineMin };
+
+// Q3, Q4, Q7과 같은 결과 (빈 트리의 최솟값은 Q7처럼 INT_MAX)
+int countOneChildNodes(ReducePool *pool, BTNode *node)
+{
+    return (int)parallelReduce(pool, node, &oneChildOp);
+}
+
+int sumOfOddNodes(ReducePool *pool, BTNode *root)
+{
+    return (int)parallelReduce(pool, root, &oddSumOp);
+}
+
+int smallestValue(ReducePool *pool, BTNode *node)
+{
+    return (int)parallelReduce(pool, node, &minOp);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static void lockDeque(Deque *dq)
+{
+    int spins = 0;
+
+    while (atomic_exchange_explicit(&dq->lock, 1, memory_order_acquire)) {
+        while (atomic_load_explicit(&dq->lock, memory_order_relaxed)) {
+            if (++spins >= 64) {
+                sched_yield();
+                spins = 0;
+            }
+        }
+    }
+}
+
+static void unlockDeque(Deque *dq)
+{
+    atomic_store_explicit(&dq->lock, 0, memory_order_release);
+}
+
+// 가득 찼거나 이미 충분히 쌓여 있으면 0 - 호출한 쪽이 그대로 직접 처리
+static int offerTask(Deque *dq, BTNode *node)
+{
+    int ok = 0;
+
+    lockDeque(dq);
+    if (dq->bottom - dq->top < DEQUE_LOW) {
+        dq->tasks[dq->bottom++ % DEQUE_SIZE] = node;
+        ok = 1;
+    }
+    unlockDeque(dq);
+    return ok;
+}
+
+static BTNode* popBottom(Deque *dq)
+{
+    BTNode *node = NULL;
+
+    lockDeque(dq);
+    if (dq->bottom > dq->top)
+        node = dq->tasks[--dq->bottom % DEQUE_SIZE];
+    if (dq->bottom == dq->top)
+        dq->top = dq->bottom = 0;
+    unlockDeque(dq);
+    return node;
+}
+
+static BTNode* stealTop(Deque *dq)
+{
+    BTNode *node = NULL;
+
+    lockDeque(dq);
+    if (dq->bottom > dq->top)
+        node = dq->tasks[dq->top++ % DEQUE_SIZE];
+    if (dq->bottom == dq->top)
+        dq->top = dq->bottom = 0;
+    unlockDeque(dq);
+    return node;
+}
+
+static void pushPending(PoolWorker *w, int *top, BTNode *node)
+{
+    if (*top == w->stackCap) {
+        w->stackCap *= 2;
+        w->stack = realloc(w->stack, sizeof(BTNode*) * w->stackCap);
+        if (w->stack == NULL)
+            exit(0);
+    }
+    w->stack[(*top)++] = node;
+}
+
+// 태스크 하나를 명시적 스택으로 순차 처리하면서 cutoff개 노드마다
+// 아직 손대지 않은 가장 오래된(트리에서 가장 위쪽, 보통 가장 큰) 서브트리를 내놓음
+// - 서브트리 크기를 모르므로 크기 대신 이렇게 처리한 노드 수로 분할 시점을 정함
+static void runTask(PoolWorker *w, BTNode *task)
+{
+    const ReduceOp *op = w->pool->op;
+    long long acc = w->partial;
+    BTNode *node;
+    int top = 0, count = 0, offered;
+
+    pushPending(w, &top, task);
+    while (top > 0) {
+        node = w->stack[--top];
+        acc = op->combine(acc, op->map(node));
+        if (node->right != NULL)
+            pushPending(w, &top, node->right);
+        if (node->left != NULL)
+            pushPending(w, &top, node->left);
+        if (++count >= w->pool->cutoff) {
+            count = 0;
+            // 스택에 하나는 남겨서 직접 계속 처리, pending은 넣기 전에 올려야 0이 잘못 보이지 않음
+            for (offered = 0; offered < top - 1; offered++) {
+                atomic_fetch_add(&w->pool->pending, 1);
+                if (!offerTask(&w->deque, w->stack[offered])) {
+                    atomic_fetch_sub(&w->pool->pending, 1);
+                    break;
+                }
+            }
+            if (offered > 0) {
+                memmove(w->stack, w->stack + offered, sizeof(BTNode*) * (top - offered));
+                top -= offered;
+            }
+        }
+    }
+    w->partial = acc;
+}
+
+static void workLoop(PoolWorker *w)
+{
+    ReducePool *pool = w->pool;
+    BTNode *task;
+    int victim, tries;
+
+    for (;;) {
+        task = popBottom(&w->deque);
+        for (tries = 0; task == NULL && tries < 2 * pool->threads; tries++) {
+            w->rng ^= w->rng << 13;
+            w->rng ^= w->rng >> 17;
+            w->rng ^= w->rng << 5;
+            victim = w->rng % pool->threads;
+            if (victim != w->id)
+                task = stealTop(&pool->workers[victim].deque);
+        }
+        if (task != NULL) {
+            runTask(w, task);
+            atomic_fetch_sub(&pool->pending, 1);
+        }
+        else if (atomic_load(&pool->pending) == 0)
+            return;
+        else
+            sched_yield();
+    }
+}
+
+static void* workerMain(void *arg)
+{
+    PoolWorker *w = arg;
+    ReducePool *pool = w->pool;
+    int seen = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->generation == seen && !pool->shutdown)
+            pthread_cond_wait(&pool->start, &pool->mutex);
+        if (pool->shutdown) {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->mutex);
+
+        workLoop(w);
+        atomic_fetch_add(&pool->finished, 1);
+    }
+}
+
+void initPool(ReducePool *pool, int threads, int cutoff)
+{
+    PoolWorker *w;
+    int i;
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > MAX_THREADS)
+        threads = MAX_THREADS;
+    pool->threads = threads;
+    pool->cutoff = cutoff < 1 ? 1 : cutoff;
+    pool->op = NULL;
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->finished, 0);
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pool->generation = 0;
+    pool->shutdown = 0;
+    for (i = 0; i < threads; i++) {
+        w = &pool->workers[i];
+        w->pool = pool;
+        w->id = i;
+        w->rng = 2463534242u + i * 40503u;
+        atomic_init(&w->deque.lock, 0);
+        w->deque.top = 0;
+        w->deque.bottom = 0;
+        w->stackCap = 64;
+        w->stack = malloc(sizeof(BTNode*) * w->stackCap);
+        if (w->stack == NULL)
+            exit(0);
+        w->partial = 0;
+    }
+    for (i = 1; i < threads; i++) {
+        if (pthread_create(&pool->workers[i].tid, NULL, workerMain, &pool->workers[i]) != 0)
+            exit(0);
+    }
+}
+
+void destroyPool(ReducePool *pool)
+{
+    int i;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+    for (i = 1; i < pool->threads; i++)
+        pthread_join(pool->workers[i].tid, NULL);
+    for (i = 0; i < pool->threads; i++)
+        free(pool->workers[i].stack);
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->start);
+}
+
+// 루트를 호출한 스레드의 덱에 넣고 모든 워커를 깨운 뒤 함께 처리,
+// pending이 0이 되면 워커별 부분 결과를 하나로 합침
+long long parallelReduce(ReducePool *pool, BTNode *root, const ReduceOp *op)
+{
+    long long result = op->identity;
+    int i;
+
+    if (root == NULL)
+        return result;
+    pool->op = op;
+    for (i = 0; i < pool->threads; i++)
+        pool->workers[i].partial = op->identity;
+    atomic_store(&pool->finished, 0);
+    atomic_store(&pool->pending, 1);
+    offerTask(&pool->workers[0].deque, root);
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+
+    workLoop(&pool->workers[0]);
+    while (atomic_load(&pool->finished) < pool->threads - 1)
+        sched_yield();
+
+    for (i = 0; i < pool->threads; i++)
+        result = op->combine(result, pool->workers[i].partial);
+    return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+BTNode *createBTNode(int item)
+{
+    BTNode *newNode = malloc(sizeof(BTNode));
+    if (newNode == NULL)
+        exit(0);
+    newNode->item = item;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    return newNode;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+BTNode *createTree()
+{
+    Stack stack;
+    BTNode *root, *temp;
+    char s;
+    int item;
+
+    stack.top = NULL;
+    root = NULL;
+    printf("Input an integer that you want to add to the binary tree. Any Alpha value will be treated as NULL.\n");
+    printf("Enter an integer value for the root: ");
+    if(scanf("%d",&item) > 0)
+    {
+        root = createBTNode(item);
+        push(&stack,root);
+    }
+    else
+    {
+        scanf("%c",&s);
+    }
+
+    while((temp =pop(&stack)) != NULL)
+    {
+
+        printf("Enter an integer value for the Left child of %d: ", temp->item);
+
+        if(scanf("%d",&item)> 0)
+        {
+            temp->left = createBTNode(item);
+        }
+        else
+        {
+            scanf("%c",&s);
+        }
+
+        printf("Enter an integer value for the Right child of %d: ", temp->item);
+        if(scanf("%d",&item)>0)
+        {
+            temp->right = createBTNode(item);
+        }
+        else
+        {
+            scanf("%c",&s);
+        }
+
+        if(temp->right != NULL)
+            push(&stack,temp->right);
+        if(temp->left != NULL)
+            push(&stack,temp->left);
+    }
+    return root;
+}
+
+void push( Stack *stack, BTNode *node)
+{
+    StackNode *temp;
+
+    temp = malloc(sizeof(StackNode));
+
+    if(temp == NULL)
+        return;
+    temp->btnode = node;
+
+    if(stack->top == NULL)
+    {
+        stack->top = temp;
+        temp->next = NULL;
+    }
+    else
+    {
+        temp->next = stack->top;
+        stack->top = temp;
+    }
+}
+
+
+BTNode* pop(Stack * stack)
+{
+    StackNode *temp, *top;
+    BTNode *ptr;
+    ptr = NULL;
+
+    top = stack->top;
+    if(top != NULL)
+    {
+        temp = top->next;
+        ptr = top->btnode;
+
+        stack->top = temp;
+        free(top);
+        top = NULL;
+    }
+
+    return ptr;
+}
+
+void printTree(BTNode *node)
+{
+    if(node == NULL) return;
+
+    printTree(node->left);
+    printf("%d ",node->item);
+    printTree(node->right);
+}
+
+void removeAll(BTNode **node)
+{
+    BTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
+    }
+    *node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 비교 기준: Q3, Q4, Q7과 같은 순차 재귀 (합은 넘치지 않게 long long)
+static long long seqOneChild(BTNode *node)
+{
+    if (node == NULL)
+        return 0;
+    return ((node->left == NULL) != (node->right == NULL))
+        + seqOneChild(node->left) + seqOneChild(node->right);
+}
+
+static long long seqOddSum(BTNode *node)
+{
+    if (node == NULL)
+        return 0;
+    return (node->item % 2 == 1 ? node->item : 0) + seqOddSum(node->left) + seqOddSum(node->right);
+}
+
+static long long seqMin(BTNode *node)
+{
+    long long ret, sub;
+
+    if (node == NULL)
+        return INT_MAX;
+    ret = node->item;
+    sub = seqMin(node->left);
+    if (sub < ret)
+        ret = sub;
+    sub = seqMin(node->right);
+    if (sub < ret)
+        ret = sub;
+    return ret;
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int nextRandom(unsigned int *state)
+{
+    unsigned int x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// n개 노드를 무작위 비율로 좌우에 나눠 붙인 트리 (한쪽 자식만 있는 노드도 생김)
+// - 재귀 대신 (부모 링크, 남은 노드 수) 스택으로 만들어서 깊어져도 안전
+static BTNode* buildRandomTree(int n, unsigned int *rng)
+{
+    typedef struct { BTNode **link; int count; } Pending;
+    Pending *todo;
+    BTNode *root = NULL, *node;
+    int top = 0, leftCount;
+
+    todo = malloc(sizeof(Pending) * (n + 1));
+    if (todo == NULL)
+        exit(0);
+    todo[top].link = &root;
+    todo[top++].count = n;
+    while (top > 0) {
+        Pending p = todo[--top];
+
+        if (p.count == 0)
+            continue;
+        node = createBTNode((int)(nextRandom(rng) % 2000001) - 1000000);
+        *p.link = node;
+        leftCount = (int)(nextRandom(rng) % (unsigned int)p.count);
+        todo[top].link = &node->left;
+        todo[top++].count = leftCount;
+        todo[top].link = &node->right;
+        todo[top++].count = p.count - 1 - leftCount;
+    }
+    free(todo);
+    return root;
+}
+
+// 같은 트리에 1, 2, 4, 8, 16개 스레드로 세 가지 리덕션을 실행 (strong scaling)
+// - 순차 재귀와 결과가 같은지 확인하고 순차 대비 속도 향상을 출력
+void benchmarkScaling(int n, int cutoff)
+{
+    static const char *names[] = { "countOneChildNodes", "sumOfOddNodes", "smallestValue" };
+    const ReduceOp *ops[3] = { &oneChildOp, &oddSumOp, &minOp };
+    long long expected[3], got;
+    double seqTime[3], seconds, start;
+    unsigned int rng = 2463534242u;
+    ReducePool pool;
+    BTNode *root;
+    int threads, k, failed = 0;
+
+    if (n <= 0)
+        return;
+    start = nowSeconds();
+    root = buildRandomTree(n, &rng);
+    printf("n = %d, cutoff %d, built in %.2f s\n", n, cutoff, nowSeconds() - start);
+
+    start = nowSeconds();
+    expected[0] = seqOneChild(root);
+    seqTime[0] = nowSeconds() - start;
+    start = nowSeconds();
+    expected[1] = seqOddSum(root);
+    seqTime[1] = nowSeconds() - start;
+    start = nowSeconds();
+    expected[2] = seqMin(root);
+    seqTime[2] = nowSeconds() - start;
+
+    printf("  threads   %20s   %20s   %20s   (ms, speedup vs sequential)\n", names[0], names[1], names[2]);
+    printf("  %7s", "seq");
+    for (k = 0; k < 3; k++)
+        printf("   %11.1f        ", seqTime[k] * 1e3);
+    printf("\n");
+    for (threads = 1; threads <= MAX_THREADS; threads *= 2) {
+        initPool(&pool, threads, cutoff);
+        printf("  %7d", threads);
+        for (k = 0; k < 3; k++) {
+            start = nowSeconds();
+            got = parallelReduce(&pool, root, ops[k]);
+            seconds = nowSeconds() - start;
+            if (got != expected[k])
+                failed = 1;
+            printf("   %11.1f (%5.2fx)", seconds * 1e3, seqTime[k] / seconds);
+        }
+        printf("\n");
+        destroyPool(&pool);
+    }
+    if (failed)
+        printf("  (CHECK FAILED)\n");
+
+    removeAll(&root);
+}
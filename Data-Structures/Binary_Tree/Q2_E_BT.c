@@ -96,9 +96,13 @@ int main()
 
 int maxHeight(BTNode *node)
 {
+    int leftHeight, rightHeight;
+
     if (node == NULL)
         return -1;
-    return 1 + maxHeight(node->left);
+    leftHeight = maxHeight(node->left);
+    rightHeight = maxHeight(node->right);
+    return 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -211,10 +215,19 @@ void printTree(BTNode *node){
 }
 
 void removeAll(BTNode **node){
-    if(*node != NULL){
-        removeAll(&((*node)->left));
-        removeAll(&((*node)->right));
-        free(*node);
-        *node = NULL;
+    BTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
     }
+    *node = NULL;
 }
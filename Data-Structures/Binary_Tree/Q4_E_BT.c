@@ -228,12 +228,20 @@ void printTree(BTNode *node)
 
 void removeAll(BTNode **node)
 {
-    if(*node != NULL)
-    {
-        removeAll(&((*node)->left));
-        removeAll(&((*node)->right));
-        free(*node);
-        *node = NULL;
+    BTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
     }
+    *node = NULL;
 }
 
@@ -0,0 +1,944 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section A - Linked List
+Purpose: Lock-free skip list ordered set (CAS insert, marked-pointer delete)
+		 with epoch-based reclamation and an in-order iterator, a multi-thread
+		 consistency test and a 1-16 thread benchmark against a global-mutex BST.
+		 Build with: gcc -O2 -pthread */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+#define SKIP_MAX_LEVEL 16		// enough index levels for 4^16 items with p = 1/4
+#define CACHE_LINE_SIZE 64
+#define MAX_THREADS 16			// callers pass a thread id in 0 .. MAX_THREADS - 1
+#define EPOCH_RETIRE_BATCH 64	// retirements between attempts to advance the epoch
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// next[i] holds the successor at level i; its low bit marks this node as
+// deleted at that level, so a CAS on the link fails once the node is marked.
+// Level 0 is marked last and decides which remove() wins.
+typedef struct _skipnode{
+	int item;
+	int topLevel;						// links next[0 .. topLevel]
+	atomic_int owners;					// inserter + deleter, the last one retires it
+	struct _skipnode *retiredNext;		// limbo list link
+	_Atomic(uintptr_t) next[];
+} SkipNode;
+
+// state = (epoch << 1) | 1 while the thread is inside an operation, 0 outside.
+// A node retired when the global epoch was e can only be reached by threads
+// that entered at epoch e or earlier, so it is freed once the global epoch
+// reaches e + 2.
+typedef struct _epochrecord{
+	_Alignas(CACHE_LINE_SIZE) atomic_uint state;
+	SkipNode *limbo[3];					// retired nodes, by epoch % 3
+	unsigned int limboEpoch[3];
+	int retiredSinceAdvance;
+	unsigned int rng;					// per-thread random level generator
+} EpochRecord;
+
+typedef struct _lockfreeskiplist{
+	SkipNode *header;					// SKIP_MAX_LEVEL links, never removed
+	_Alignas(CACHE_LINE_SIZE) atomic_uint globalEpoch;
+	EpochRecord records[MAX_THREADS];
+} LockFreeSkipList;
+
+// Weakly consistent: sees every key present for the whole iteration, and
+// may or may not see keys inserted or removed meanwhile. The thread stays
+// inside its epoch until freeSkipIterator(), so keep iterations short.
+typedef struct _skipiterator{
+	LockFreeSkipList *sl;
+	int tid;
+	SkipNode *node;
+} SkipIterator;
+
+typedef struct _bstnode{
+	int item;
+	struct _bstnode *left;
+	struct _bstnode *right;
+} BSTNode;
+
+typedef struct _lockedbst{
+	pthread_mutex_t mutex;
+	BSTNode *root;
+} LockedBST;	// one big lock around the plain BST, only used by the benchmark
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+void initSkipList(LockFreeSkipList *sl);
+void destroySkipList(LockFreeSkipList *sl);
+int insertSkipList(LockFreeSkipList *sl, int tid, int value);
+int removeSkipList(LockFreeSkipList *sl, int tid, int value);
+int searchSkipList(LockFreeSkipList *sl, int tid, int value);
+
+void initSkipIterator(SkipIterator *it, LockFreeSkipList *sl, int tid, int lo);
+int nextInSkipList(SkipIterator *it, int *value);
+void freeSkipIterator(SkipIterator *it);
+void printSkipList(LockFreeSkipList *sl);
+int checkSkipList(LockFreeSkipList *sl);
+
+int concurrencyTest(int threads, int keysPerThread);
+void benchmarkScaling(int keyRange, int totalOps);
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	LockFreeSkipList sl;
+	SkipIterator it;
+	int c, i, j, value;
+	c = 1;
+
+	//Initialize the skip list as an empty ordered set, used here as thread 0
+	initSkipList(&sl);
+
+	printf("1: Insert an integer into the skip list:\n");
+	printf("2: Remove an integer from the skip list:\n");
+	printf("3: Search for an integer in the skip list:\n");
+	printf("4: Print the skip list in order:\n");
+	printf("5: Print up to k integers from a lower bound:\n");
+	printf("6: Run the multi-thread consistency test:\n");
+	printf("7: Run the 1-16 thread benchmark against a global-mutex BST:\n");
+	printf("0: Quit:\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-7/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the skip list: ");
+			scanf("%d", &i);
+			if (insertSkipList(&sl, 0, i) == 0)
+				printf("%d is already in the skip list\n", i);
+			printf("The resulting skip list is: ");
+			printSkipList(&sl);
+			break;
+		case 2:
+			printf("Input an integer that you want to remove from the skip list: ");
+			scanf("%d", &i);
+			if (removeSkipList(&sl, 0, i) == 0)
+				printf("%d is not in the skip list\n", i);
+			printf("The resulting skip list is: ");
+			printSkipList(&sl);
+			break;
+		case 3:
+			printf("Input an integer that you want to search for: ");
+			scanf("%d", &i);
+			if (searchSkipList(&sl, 0, i))
+				printf("%d is in the skip list\n", i);
+			else
+				printf("%d is not in the skip list\n", i);
+			break;
+		case 4:
+			printf("The resulting skip list is: ");
+			printSkipList(&sl);
+			break;
+		case 5:
+			printf("Input the lower bound and k: ");
+			scanf("%d %d", &i, &j);
+			printf("The integers are: ");
+			initSkipIterator(&it, &sl, 0, i);
+			while (j-- > 0 && nextInSkipList(&it, &value))
+				printf("%d ", value);
+			freeSkipIterator(&it);
+			printf("\n");
+			break;
+		case 6:
+			printf("Input the number of threads and the keys per thread: ");
+			scanf("%d %d", &i, &j);
+			if (concurrencyTest(i, j))
+				printf("Test passed: every operation and the final list were consistent\n");
+			else
+				printf("Test FAILED\n");
+			break;
+		case 7:
+			printf("Input the key range and the total number of operations: ");
+			scanf("%d %d", &i, &j);
+			benchmarkScaling(i, j);
+			break;
+		case 0:
+			destroySkipList(&sl);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#define MARKED(p) ((p) & 1)
+#define PTR(p) ((SkipNode*)((p) & ~(uintptr_t)1))
+
+static SkipNode *createSkipNode(int topLevel, int item)
+{
+	SkipNode *node = malloc(sizeof(SkipNode) + (topLevel + 1) * sizeof(_Atomic(uintptr_t)));
+	int i;
+
+	if (node == NULL)
+		exit(0);
+	node->item = item;
+	node->topLevel = topLevel;
+	atomic_init(&node->owners, 2);
+	node->retiredNext = NULL;
+	for (i = 0; i <= topLevel; i++)
+		atomic_init(&node->next[i], 0);
+	return node;
+}
+
+static void freeChain(SkipNode *node)
+{
+	SkipNode *next;
+
+	while (node != NULL) {
+		next = node->retiredNext;
+		free(node);
+		node = next;
+	}
+}
+
+void initSkipList(LockFreeSkipList *sl)
+{
+	int t, b;
+
+	sl->header = createSkipNode(SKIP_MAX_LEVEL - 1, 0);
+	atomic_init(&sl->globalEpoch, 0);
+	for (t = 0; t < MAX_THREADS; t++) {
+		atomic_init(&sl->records[t].state, 0);
+		for (b = 0; b < 3; b++) {
+			sl->records[t].limbo[b] = NULL;
+			sl->records[t].limboEpoch[b] = 0;
+		}
+		sl->records[t].retiredSinceAdvance = 0;
+		sl->records[t].rng = 2463534242u + 0x9e3779b9u * t;
+	}
+}
+
+// 다른 스레드가 없을 때만 호출 - 0층을 따라 남은 노드를 모두 해제하고 limbo도 비움
+void destroySkipList(LockFreeSkipList *sl)
+{
+	SkipNode *node = PTR(atomic_load(&sl->header->next[0]));
+	SkipNode *next;
+	int t, b;
+
+	while (node != NULL) {
+		next = PTR(atomic_load(&node->next[0]));
+		free(node);
+		node = next;
+	}
+	for (t = 0; t < MAX_THREADS; t++) {
+		for (b = 0; b < 3; b++) {
+			freeChain(sl->records[t].limbo[b]);
+			sl->records[t].limbo[b] = NULL;
+		}
+	}
+	free(sl->header);
+	sl->header = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 연산 시작: 지금의 전역 epoch를 active로 공개 (seq_cst라 이후 읽기가 앞당겨지지 않음)
+static void enterEpoch(LockFreeSkipList *sl, int tid)
+{
+	unsigned int e = atomic_load(&sl->globalEpoch);
+
+	atomic_store(&sl->records[tid].state, (e << 1) | 1);
+}
+
+static void exitEpoch(LockFreeSkipList *sl, int tid)
+{
+	atomic_store_explicit(&sl->records[tid].state, 0, memory_order_release);
+}
+
+// active인 스레드가 모두 현재 epoch에 들어와 있을 때만 한 칸 올림
+static void tryAdvanceEpoch(LockFreeSkipList *sl)
+{
+	unsigned int e = atomic_load(&sl->globalEpoch);
+	unsigned int s;
+	int t;
+
+	for (t = 0; t < MAX_THREADS; t++) {
+		s = atomic_load(&sl->records[t].state);
+		if ((s & 1) && (s >> 1) != e)
+			return;
+	}
+	atomic_compare_exchange_strong(&sl->globalEpoch, &e, e + 1);
+}
+
+// 모든 층에서 떼어낸 노드만 넘어옴 -> 지금 epoch의 limbo에 넣음
+// - 같은 칸에 3 epoch 전 노드가 남아 있으면 전역 epoch가 이미 2 이상 앞서므로 먼저 해제
+static void retireNode(LockFreeSkipList *sl, int tid, SkipNode *node)
+{
+	EpochRecord *rec = &sl->records[tid];
+	unsigned int e = atomic_load(&sl->globalEpoch);
+	int b = e % 3;
+
+	if (rec->limboEpoch[b] != e) {
+		freeChain(rec->limbo[b]);
+		rec->limbo[b] = NULL;
+		rec->limboEpoch[b] = e;
+	}
+	node->retiredNext = rec->limbo[b];
+	rec->limbo[b] = node;
+
+	if (++rec->retiredSinceAdvance >= EPOCH_RETIRE_BATCH) {
+		rec->retiredSinceAdvance = 0;
+		tryAdvanceEpoch(sl);
+		e = atomic_load(&sl->globalEpoch);
+		for (b = 0; b < 3; b++) {
+			if (rec->limbo[b] != NULL && e - rec->limboEpoch[b] >= 2) {
+				freeChain(rec->limbo[b]);
+				rec->limbo[b] = NULL;
+			}
+		}
+	}
+}
+
+// 확률 1/4로 한 층씩 올라가는 무작위 높이 (스레드마다 xorshift 상태를 따로 씀)
+static int randomLevel(EpochRecord *rec)
+{
+	unsigned int x = rec->rng;
+	int level = 0;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	rec->rng = x;
+	while (level < SKIP_MAX_LEVEL - 1 && (x & 3) == 0) {
+		level++;
+		x >>= 2;
+	}
+	return level;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 각 층에서 value 바로 앞(preds)과 value 이상인 첫 노드(succs)를 찾음
+// - 지나가다 표시된 노드를 만나면 CAS로 떼어냄, 실패하면 맨 위부터 다시
+// - 0층에 표시 안 된 value 노드가 있으면 1
+static int findNode(LockFreeSkipList *sl, int value, SkipNode **preds, SkipNode **succs)
+{
+	SkipNode *pred, *curr;
+	uintptr_t succ, expected;
+	int level;
+
+retry:
+	pred = sl->header;
+	for (level = SKIP_MAX_LEVEL - 1; level >= 0; level--) {
+		curr = PTR(atomic_load(&pred->next[level]));
+		while (curr != NULL) {
+			succ = atomic_load(&curr->next[level]);
+			if (MARKED(succ)) {
+				expected = (uintptr_t)curr;
+				if (!atomic_compare_exchange_strong(&pred->next[level], &expected,
+						(uintptr_t)PTR(succ)))
+					goto retry;
+				curr = PTR(succ);
+			}
+			else if (curr->item < value) {
+				pred = curr;
+				curr = PTR(succ);
+			}
+			else {
+				break;
+			}
+		}
+		preds[level] = pred;
+		succs[level] = curr;
+	}
+	return succs[0] != NULL && succs[0]->item == value;
+}
+
+// Returns 1 if value was added, 0 if it was already present
+int insertSkipList(LockFreeSkipList *sl, int tid, int value)
+{
+	SkipNode *preds[SKIP_MAX_LEVEL], *succs[SKIP_MAX_LEVEL];
+	SkipNode *node = NULL;
+	uintptr_t expected, link;
+	int topLevel, level;
+
+	enterEpoch(sl, tid);
+	topLevel = randomLevel(&sl->records[tid]);
+	for (;;) {
+		if (findNode(sl, value, preds, succs)) {
+			exitEpoch(sl, tid);
+			free(node);		// 한 번도 연결된 적 없는 노드라 바로 해제해도 됨
+			return 0;
+		}
+		if (node == NULL)
+			node = createSkipNode(topLevel, value);
+		for (level = 0; level <= topLevel; level++)
+			atomic_store_explicit(&node->next[level], (uintptr_t)succs[level], memory_order_relaxed);
+		// 0층에 연결되는 순간이 삽입 시점
+		expected = (uintptr_t)succs[0];
+		if (atomic_compare_exchange_strong(&preds[0]->next[0], &expected, (uintptr_t)node))
+			break;
+	}
+
+	// 위층 연결: 그 사이 누가 지우기 시작했으면 (next가 표시됨) 더 올리지 않음
+	for (level = 1; level <= topLevel; level++) {
+		for (;;) {
+			link = atomic_load(&node->next[level]);
+			if (MARKED(link))
+				goto linked;
+			if (PTR(link) != succs[level]
+				&& !atomic_compare_exchange_strong(&node->next[level], &link, (uintptr_t)succs[level]))
+				goto linked;
+			expected = (uintptr_t)succs[level];
+			if (atomic_compare_exchange_strong(&preds[level]->next[level], &expected, (uintptr_t)node))
+				break;
+			findNode(sl, value, preds, succs);
+			if (succs[0] != node)
+				goto linked;
+		}
+	}
+
+linked:
+	// 지우는 쪽이 이미 정리를 끝낸 뒤에 위층에 연결했을 수 있으므로 한 번 더 떼어냄
+	if (MARKED(atomic_load(&node->next[0])))
+		findNode(sl, value, preds, succs);
+	if (atomic_fetch_sub(&node->owners, 1) == 1)
+		retireNode(sl, tid, node);
+	exitEpoch(sl, tid);
+	return 1;
+}
+
+// Returns 1 if value was removed, 0 if it was not present
+// - 위층부터 표시하고 마지막에 0층을 표시하는 스레드가 삭제에 성공한 것
+int removeSkipList(LockFreeSkipList *sl, int tid, int value)
+{
+	SkipNode *preds[SKIP_MAX_LEVEL], *succs[SKIP_MAX_LEVEL];
+	SkipNode *node;
+	uintptr_t link;
+	int level;
+
+	enterEpoch(sl, tid);
+	if (!findNode(sl, value, preds, succs)) {
+		exitEpoch(sl, tid);
+		return 0;
+	}
+	node = succs[0];
+	for (level = node->topLevel; level >= 1; level--) {
+		link = atomic_load(&node->next[level]);
+		while (!MARKED(link))
+			atomic_compare_exchange_weak(&node->next[level], &link, link | 1);
+	}
+	link = atomic_load(&node->next[0]);
+	for (;;) {
+		if (MARKED(link)) {
+			exitEpoch(sl, tid);
+			return 0;	// 다른 스레드가 먼저 지움
+		}
+		if (atomic_compare_exchange_weak(&node->next[0], &link, link | 1))
+			break;
+	}
+
+	// 모든 층에서 떼어낸 뒤에야 limbo로 보낼 수 있음
+	findNode(sl, value, preds, succs);
+	if (atomic_fetch_sub(&node->owners, 1) == 1)
+		retireNode(sl, tid, node);
+	exitEpoch(sl, tid);
+	return 1;
+}
+
+// Returns 1 if value is present; never writes to shared memory except the
+// thread's own epoch record
+int searchSkipList(LockFreeSkipList *sl, int tid, int value)
+{
+	SkipNode *pred = sl->header, *curr = NULL;
+	uintptr_t succ;
+	int level, found;
+
+	enterEpoch(sl, tid);
+	for (level = SKIP_MAX_LEVEL - 1; level >= 0; level--) {
+		curr = PTR(atomic_load(&pred->next[level]));
+		while (curr != NULL) {
+			succ = atomic_load(&curr->next[level]);
+			if (MARKED(succ))
+				curr = PTR(succ);		// 떼어내지 않고 건너뛰기만 함
+			else if (curr->item < value) {
+				pred = curr;
+				curr = PTR(succ);
+			}
+			else
+				break;
+		}
+	}
+	found = curr != NULL && curr->item == value;
+	exitEpoch(sl, tid);
+	return found;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// lo 이상인 첫 노드 바로 앞에 멈춤 - 반복하는 동안 이 스레드는 epoch 안에 머묾
+void initSkipIterator(SkipIterator *it, LockFreeSkipList *sl, int tid, int lo)
+{
+	SkipNode *preds[SKIP_MAX_LEVEL], *succs[SKIP_MAX_LEVEL];
+
+	it->sl = sl;
+	it->tid = tid;
+	enterEpoch(sl, tid);
+	findNode(sl, lo, preds, succs);
+	it->node = preds[0];
+}
+
+// Stores the next key in *value and returns 1, or returns 0 at the end
+int nextInSkipList(SkipIterator *it, int *value)
+{
+	SkipNode *node;
+	uintptr_t link;
+
+	if (it->node == NULL)
+		return 0;
+	node = PTR(atomic_load(&it->node->next[0]));
+	while (node != NULL) {
+		link = atomic_load(&node->next[0]);
+		if (!MARKED(link))
+			break;
+		node = PTR(link);		// 지워진 노드는 건너뜀
+	}
+	it->node = node;
+	if (node == NULL)
+		return 0;
+	*value = node->item;
+	return 1;
+}
+
+void freeSkipIterator(SkipIterator *it)
+{
+	if (it->sl != NULL)
+		exitEpoch(it->sl, it->tid);
+	it->sl = NULL;
+	it->node = NULL;
+}
+
+void printSkipList(LockFreeSkipList *sl)
+{
+	SkipIterator it;
+	int value, count = 0;
+
+	initSkipIterator(&it, sl, 0, -2147483647 - 1);
+	while (nextInSkipList(&it, &value)) {
+		printf("%d ", value);
+		count++;
+	}
+	freeSkipIterator(&it);
+	if (count == 0)
+		printf("Empty");
+	printf("\n");
+}
+
+// 층마다 키가 순증가하고 위층 노드가 모두 0층에도 있는지 확인, 표시된 노드가 남으면 실패
+// Returns the number of keys, or -1; only meaningful while no other thread runs
+int checkSkipList(LockFreeSkipList *sl)
+{
+	SkipNode *node, *below;
+	uintptr_t link;
+	int level, count = 0;
+
+	for (level = 0; level < SKIP_MAX_LEVEL; level++) {
+		below = sl->header;
+		for (node = PTR(atomic_load(&sl->header->next[level])); node != NULL; node = PTR(link)) {
+			link = atomic_load(&node->next[level]);
+			if (MARKED(link) || node->topLevel < level)
+				return -1;
+			if (level == 0) {
+				if (below != sl->header && below->item >= node->item)
+					return -1;
+				below = node;
+				count++;
+			}
+			else {
+				// 0층에서 이 노드를 찾아야 함 (앞 노드부터 이어서 찾으므로 층 전체가 O(n))
+				while (below != NULL && below != node)
+					below = PTR(atomic_load(&below->next[0]));
+				if (below == NULL)
+					return -1;
+			}
+		}
+	}
+	return count;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Plain BST behind one mutex, the way the services share it today
+
+static void insertBSTNode(BSTNode **node, int value){
+	if (*node == NULL)
+	{
+		*node = malloc(sizeof(BSTNode));
+
+		if (*node != NULL) {
+			(*node)->item = value;
+			(*node)->left = NULL;
+			(*node)->right = NULL;
+		}
+	}
+	else
+	{
+		if (value < (*node)->item)
+		{
+			insertBSTNode(&((*node)->left), value);
+		}
+		else if (value >(*node)->item)
+		{
+			insertBSTNode(&((*node)->right), value);
+		}
+		else
+			return;
+	}
+}
+
+static BSTNode* removeNodeFromTree(BSTNode *root, int value) {
+	BSTNode *temp, *successor;
+
+	if (root == NULL)
+		return NULL;
+
+	if (value < root->item) {
+		root->left = removeNodeFromTree(root->left, value);
+	}
+	else if (value > root->item) {
+		root->right = removeNodeFromTree(root->right, value);
+	}
+	else {
+		if (root->left == NULL) {
+			temp = root->right;
+			free(root);
+			return temp;
+		}
+		else if (root->right == NULL) {
+			temp = root->left;
+			free(root);
+			return temp;
+		}
+		successor = root->right;
+		while (successor->left != NULL)
+			successor = successor->left;
+		root->item = successor->item;
+		root->right = removeNodeFromTree(root->right, successor->item);
+	}
+	return root;
+}
+
+static int searchBSTNode(BSTNode *node, int value)
+{
+	while (node != NULL) {
+		if (value == node->item)
+			return 1;
+		node = value < node->item ? node->left : node->right;
+	}
+	return 0;
+}
+
+static void removeAll(BSTNode **node)
+{
+	BSTNode *cur = *node, *next;
+
+	while (cur != NULL) {
+		if (cur->left == NULL) {
+			next = cur->right;
+			free(cur);
+		}
+		else {
+			next = cur->left;
+			cur->left = next->right;
+			next->right = cur;
+		}
+		cur = next;
+	}
+	*node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static unsigned int fmix32(unsigned int h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+static unsigned int nextRandom(unsigned int *state)
+{
+	unsigned int x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+typedef struct _testworker
+{
+	LockFreeSkipList *sl;
+	int id;
+	int threads;
+	int keysPerThread;
+	const int *order;		// shuffled 0..keysPerThread-1
+	atomic_int *ok;
+} TestWorker;
+
+// 스레드 t는 i * threads + t 꼴의 키만 넣고 빼고, 모든 스레드가 공유 키 -1..-k를
+// 계속 넣었다 뺐다 함 (공유 키는 결과를 알 수 없지만 같은 노드를 두고 경쟁하게 만듦)
+// - 자기 키는 세 번 넣고 빼서 해제된 노드를 다시 밟는 경우가 많이 생기도록 함
+static void *testMain(void *arg)
+{
+	TestWorker *me = arg;
+	unsigned int rng = fmix32(me->id + 1);
+	int round, i, key, shared;
+
+	for (round = 0; round < 3; round++) {
+		for (i = 0; i < me->keysPerThread; i++) {
+			key = me->order[(i + me->id) % me->keysPerThread] * me->threads + me->id;
+			if (insertSkipList(me->sl, me->id, key) != 1 || !searchSkipList(me->sl, me->id, key))
+				atomic_store(me->ok, 0);
+			shared = -1 - (int)(nextRandom(&rng) % me->keysPerThread);
+			if (nextRandom(&rng) & 1)
+				insertSkipList(me->sl, me->id, shared);
+			else
+				removeSkipList(me->sl, me->id, shared);
+		}
+		for (i = 0; i < me->keysPerThread; i++) {
+			key = i * me->threads + me->id;
+			if (!searchSkipList(me->sl, me->id, key))
+				atomic_store(me->ok, 0);
+			if (round < 2 || i % 2 == 0) {
+				if (removeSkipList(me->sl, me->id, key) != 1 || searchSkipList(me->sl, me->id, key))
+					atomic_store(me->ok, 0);
+			}
+		}
+	}
+	return NULL;
+}
+
+// 끝난 뒤 각 층의 정렬 상태, 표시된 노드가 없는지, 남은 자기 키가 정확한지 확인
+int concurrencyTest(int threads, int keysPerThread)
+{
+	LockFreeSkipList sl;
+	SkipIterator it;
+	pthread_t tid[MAX_THREADS];
+	TestWorker workers[MAX_THREADS];
+	atomic_int ok;
+	unsigned int rng = 12345;
+	int *order;
+	int t, i, j, tmp, count, value, prev = 0;
+
+	if (threads <= 0 || threads > MAX_THREADS || keysPerThread <= 0)
+		return 0;
+	if (keysPerThread > 0x7fffffff / threads)
+		return 0;
+	order = malloc(sizeof(int) * keysPerThread);
+	if (order == NULL)
+		return 0;
+	for (i = 0; i < keysPerThread; i++)
+		order[i] = i;
+	for (i = keysPerThread - 1; i > 0; i--) {
+		j = nextRandom(&rng) % (i + 1);
+		tmp = order[i];
+		order[i] = order[j];
+		order[j] = tmp;
+	}
+	initSkipList(&sl);
+	atomic_init(&ok, 1);
+
+	for (t = 0; t < threads; t++) {
+		workers[t].sl = &sl;
+		workers[t].id = t;
+		workers[t].threads = threads;
+		workers[t].keysPerThread = keysPerThread;
+		workers[t].order = order;
+		workers[t].ok = &ok;
+		if (pthread_create(&tid[t], NULL, testMain, &workers[t]) != 0)
+			exit(0);
+	}
+	for (t = 0; t < threads; t++)
+		pthread_join(tid[t], NULL);
+
+	count = checkSkipList(&sl);
+	if (count == -1)
+		atomic_store(&ok, 0);
+	for (t = 0; t < threads; t++) {
+		for (i = 0; i < keysPerThread; i++) {
+			if (searchSkipList(&sl, 0, i * threads + t) != (i % 2 == 1))
+				atomic_store(&ok, 0);
+		}
+	}
+	// 반복자도 같은 개수를 오름차순으로 돌려줘야 함
+	initSkipIterator(&it, &sl, 0, -2147483647 - 1);
+	for (i = 0; nextInSkipList(&it, &value); i++) {
+		if (i > 0 && value <= prev)
+			atomic_store(&ok, 0);
+		prev = value;
+	}
+	freeSkipIterator(&it);
+	if (i != count)
+		atomic_store(&ok, 0);
+
+	destroySkipList(&sl);
+	free(order);
+	return atomic_load(&ok);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _workload
+{
+	LockFreeSkipList *sl;	// exactly one of sl / locked is set
+	LockedBST *locked;
+	int keyRange;
+	int readPercent;
+	int opsPerThread;
+} Workload;
+
+typedef struct _worker
+{
+	Workload *w;
+	int id;
+	long long found;
+} Worker;
+
+static void *benchMain(void *arg)
+{
+	Worker *me = arg;
+	Workload *w = me->w;
+	unsigned int rng = fmix32(me->id * 7919 + 1);
+	unsigned int r;
+	int i, key, op;
+
+	for (i = 0; i < w->opsPerThread; i++) {
+		r = nextRandom(&rng);
+		key = (int)((r >> 8) % w->keyRange);
+		// 쓰기는 삽입과 삭제를 반씩 -> 크기가 keyRange / 2 근처로 유지됨
+		op = r % 100 < (unsigned int)w->readPercent ? 0 : (r & 0x80) ? 1 : 2;
+		if (w->sl != NULL) {
+			if (op == 0)
+				me->found += searchSkipList(w->sl, me->id, key);
+			else if (op == 1)
+				insertSkipList(w->sl, me->id, key);
+			else
+				removeSkipList(w->sl, me->id, key);
+		}
+		else {
+			pthread_mutex_lock(&w->locked->mutex);
+			if (op == 0)
+				me->found += searchBSTNode(w->locked->root, key);
+			else if (op == 1)
+				insertBSTNode(&w->locked->root, key);
+			else
+				w->locked->root = removeNodeFromTree(w->locked->root, key);
+			pthread_mutex_unlock(&w->locked->mutex);
+		}
+	}
+	return NULL;
+}
+
+static double nowSeconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double runWorkload(Workload *w, int threads)
+{
+	pthread_t tid[MAX_THREADS];
+	Worker workers[MAX_THREADS];
+	double start;
+	int i;
+
+	for (i = 0; i < threads; i++) {
+		workers[i].w = w;
+		workers[i].id = i;
+		workers[i].found = 0;
+	}
+	start = nowSeconds();
+	for (i = 0; i < threads; i++) {
+		if (pthread_create(&tid[i], NULL, benchMain, &workers[i]) != 0)
+			exit(0);
+	}
+	for (i = 0; i < threads; i++)
+		pthread_join(tid[i], NULL);
+	return nowSeconds() - start;
+}
+
+// 같은 무작위 절반 키로 채운 뒤 1, 2, 4, 8, 16개 스레드로 totalOps개 연산 실행
+void benchmarkScaling(int keyRange, int totalOps)
+{
+	static const int mixes[] = { 90, 50 };
+	LockFreeSkipList sl;
+	LockedBST locked;
+	Workload w;
+	unsigned int rng;
+	double seconds[2];
+	int mix, threads, kind, i;
+
+	if (keyRange <= 0 || totalOps <= 0)
+		return;
+	for (mix = 0; mix < 2; mix++) {
+		printf("%d%% search / %d%% insert+remove, %d keys:\n", mixes[mix], 100 - mixes[mix], keyRange);
+		printf("  threads   global-mutex BST   lock-free skip list   (M ops/s)\n");
+		for (threads = 1; threads <= MAX_THREADS; threads *= 2) {
+			for (kind = 0; kind < 2; kind++) {
+				w.sl = NULL;
+				w.locked = NULL;
+				w.keyRange = keyRange;
+				w.readPercent = mixes[mix];
+				w.opsPerThread = totalOps / threads;
+
+				rng = 2463534242u;
+				if (kind == 1) {
+					initSkipList(&sl);
+					for (i = 0; i < keyRange / 2; i++)
+						insertSkipList(&sl, 0, (int)(nextRandom(&rng) % keyRange));
+					w.sl = &sl;
+				}
+				else {
+					pthread_mutex_init(&locked.mutex, NULL);
+					locked.root = NULL;
+					for (i = 0; i < keyRange / 2; i++)
+						insertBSTNode(&locked.root, (int)(nextRandom(&rng) % keyRange));
+					w.locked = &locked;
+				}
+
+				seconds[kind] = runWorkload(&w, threads);
+
+				if (kind == 1) {
+					if (checkSkipList(&sl) == -1)
+						printf("  (CHECK FAILED)\n");
+					destroySkipList(&sl);
+				}
+				else {
+					removeAll(&locked.root);
+					pthread_mutex_destroy(&locked.mutex);
+				}
+			}
+			printf("  %7d   %16.2f   %19.2f\n", threads,
+				seconds[0] > 0 ? (double)w.opsPerThread * threads / seconds[0] / 1e6 : 0.0,
+				seconds[1] > 0 ? (double)w.opsPerThread * threads / seconds[1] / 1e6 : 0.0);
+		}
+	}
+}
@@ -0,0 +1,421 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section A - Linked List
+Purpose: Slab pool allocator for ListNode with an intrusive free list,
+		 and a malloc vs pool churn benchmark */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define POOL_CHUNK_NODES 1024	// 1024 * 16 bytes = one 16KB slab per chunk
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _listnode{
+	int item;
+	struct _listnode *next;
+} ListNode;
+
+typedef struct _poolchunk{
+	struct _poolchunk *next;
+	ListNode nodes[POOL_CHUNK_NODES];
+} PoolChunk;
+
+typedef struct _nodepool{
+	PoolChunk *chunks;		// every slab allocated so far
+	ListNode *freeList;		// recycled nodes, linked through ListNode.next
+	int bumpIndex;			// next untouched node in chunks (the newest slab)
+	int chunkCount;
+	int liveNodes;
+} NodePool;
+
+typedef struct _linkedlist{
+	int size;
+	ListNode *head;
+	ListNode *tail;
+	NodePool *pool;			// NULL: nodes come from malloc/free
+} LinkedList;
+
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+void initPool(NodePool *pool);
+void destroyPool(NodePool *pool);
+ListNode *allocNode(NodePool *pool);
+void freeNode(NodePool *pool, ListNode *node);
+void freeChain(NodePool *pool, ListNode *head, ListNode *tail, int count);
+void printPoolStats(NodePool *pool);
+void benchmarkChurn(int n, int rounds);
+
+void printList(LinkedList *ll);
+void removeAllItems(LinkedList *ll);
+ListNode *findNode(LinkedList *ll, int index);
+int insertNode(LinkedList *ll, int index, int value);
+int appendNode(LinkedList *ll, int value);
+int removeNode(LinkedList *ll, int index);
+
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	LinkedList ll;
+	NodePool pool;
+	int c, i, j;
+	c = 1;
+
+	initPool(&pool);
+
+	//Initialize the linked list as an empty pool-backed linked list
+	ll.head = NULL;
+	ll.tail = NULL;
+	ll.size = 0;
+	ll.pool = &pool;
+
+	printf("1: Insert an integer to the linked list:\n");
+	printf("2: Remove the integer at an index:\n");
+	printf("3: Print the pool statistics:\n");
+	printf("4: Run the malloc vs pool churn benchmark:\n");
+	printf("0: Quit:\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1/2/3/4/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to add to the linked list: ");
+			scanf("%d", &i);
+			insertNode(&ll, ll.size, i);
+			printf("The resulting linked list is: ");
+			printList(&ll);
+			break;
+		case 2:
+			printf("Input the index that you want to remove: ");
+			scanf("%d", &j);
+			if (removeNode(&ll, j) == -1)
+				printf("Index out of range\n");
+			printf("The resulting linked list is: ");
+			printList(&ll);
+			break;
+		case 3:
+			printPoolStats(&pool);
+			break;
+		case 4:
+			printf("Input the list size and the number of rounds: ");
+			scanf("%d %d", &i, &j);
+			benchmarkChurn(i, j);
+			break;
+		case 0:
+			removeAllItems(&ll);
+			destroyPool(&pool);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void initPool(NodePool *pool)
+{
+	pool->chunks = NULL;
+	pool->freeList = NULL;
+	pool->bumpIndex = POOL_CHUNK_NODES;	// 첫 할당 때 슬랩을 새로 잡도록
+	pool->chunkCount = 0;
+	pool->liveNodes = 0;
+}
+
+// 풀 전체를 슬랩 단위로 반납 - 노드 수와 무관하게 O(chunks)
+void destroyPool(NodePool *pool)
+{
+	PoolChunk *chunk = pool->chunks;
+	PoolChunk *next;
+
+	while (chunk) {
+		next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+	initPool(pool);
+}
+
+// 노드 하나 할당
+// - pool이 NULL이면 기존처럼 malloc
+// - free list에 재활용 노드가 있으면 그것부터 사용
+// - 없으면 최신 슬랩에서 bump 할당, 슬랩이 다 찼으면 새 슬랩 추가
+ListNode *allocNode(NodePool *pool)
+{
+	ListNode *node;
+
+	if (pool == NULL) {
+		node = malloc(sizeof(ListNode));
+		if (node == NULL)
+			exit(0);
+		return node;
+	}
+
+	if (pool->freeList) {
+		node = pool->freeList;
+		pool->freeList = node->next;
+	}
+	else {
+		if (pool->bumpIndex == POOL_CHUNK_NODES) {
+			PoolChunk *chunk = malloc(sizeof(PoolChunk));
+			if (chunk == NULL)
+				exit(0);
+			chunk->next = pool->chunks;
+			pool->chunks = chunk;
+			pool->bumpIndex = 0;
+			pool->chunkCount++;
+		}
+		node = &pool->chunks->nodes[pool->bumpIndex++];
+	}
+	pool->liveNodes++;
+	return node;
+}
+
+// 노드 하나 반납 - free list의 맨 앞에 끼워 넣기만 함
+void freeNode(NodePool *pool, ListNode *node)
+{
+	if (pool == NULL) {
+		free(node);
+		return;
+	}
+	node->next = pool->freeList;
+	pool->freeList = node;
+	pool->liveNodes--;
+}
+
+// head ~ tail 로 이어진 노드 count개를 한 번에 반납
+// - 노드들이 이미 next로 연결되어 있으므로 tail 뒤에 free list를 붙이면 끝 (O(1))
+void freeChain(NodePool *pool, ListNode *head, ListNode *tail, int count)
+{
+	ListNode *tmp;
+
+	if (head == NULL)
+		return;
+
+	if (pool == NULL) {
+		while (head) {
+			tmp = head->next;
+			free(head);
+			head = tmp;
+		}
+		return;
+	}
+	tail->next = pool->freeList;
+	pool->freeList = head;
+	pool->liveNodes -= count;
+}
+
+void printPoolStats(NodePool *pool)
+{
+	printf("Pool: %d chunk(s) of %d nodes, %d live node(s), %d KB reserved\n",
+		pool->chunkCount, POOL_CHUNK_NODES, pool->liveNodes,
+		(int)(pool->chunkCount * sizeof(PoolChunk) / 1024));
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 같은 churn 패턴을 malloc 리스트와 pool 리스트에 각각 돌려서 시간 비교
+// - 앞쪽 삽입 n번, 앞쪽 삭제 n/2번, 뒤쪽 추가 n/2번, 전체 비우기를 rounds번 반복
+void benchmarkChurn(int n, int rounds)
+{
+	NodePool pool;
+	LinkedList ll;
+	clock_t start;
+	double elapsed[2];
+	long long ops;
+	int mode, r, i;
+
+	if (n <= 0 || rounds <= 0)
+		return;
+
+	ops = (long long)rounds * (n + n / 2 + n / 2 + 1);
+
+	for (mode = 0; mode < 2; mode++) {
+		initPool(&pool);
+		ll.head = NULL;
+		ll.tail = NULL;
+		ll.size = 0;
+		ll.pool = mode ? &pool : NULL;
+
+		start = clock();
+		for (r = 0; r < rounds; r++) {
+			for (i = 0; i < n; i++)
+				insertNode(&ll, 0, i);
+			for (i = 0; i < n / 2; i++)
+				removeNode(&ll, 0);
+			for (i = 0; i < n / 2; i++)
+				appendNode(&ll, i);
+			removeAllItems(&ll);
+		}
+		elapsed[mode] = (double)(clock() - start) / CLOCKS_PER_SEC;
+		destroyPool(&pool);
+	}
+
+	printf("malloc: %.3f s (%.1f ns/op)\n", elapsed[0], elapsed[0] * 1e9 / ops);
+	printf("pool:   %.3f s (%.1f ns/op)\n", elapsed[1], elapsed[1] * 1e9 / ops);
+	if (elapsed[1] > 0)
+		printf("speedup: %.2fx\n", elapsed[0] / elapsed[1]);
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void printList(LinkedList *ll){
+
+	ListNode *cur;
+	if (ll == NULL)
+		return;
+	cur = ll->head;
+
+	if (cur == NULL)
+		printf("Empty");
+	while (cur != NULL)
+	{
+		printf("%d ", cur->item);
+		cur = cur->next;
+	}
+	printf("\n");
+}
+
+
+void removeAllItems(LinkedList *ll)
+{
+	// Hand the whole chain back in one step instead of freeing node by node
+	freeChain(ll->pool, ll->head, ll->tail, ll->size);
+	ll->head = NULL;
+	ll->tail = NULL;
+	ll->size = 0;
+}
+
+
+ListNode *findNode(LinkedList *ll, int index){
+
+	ListNode *temp;
+
+	if (ll == NULL || index < 0 || index >= ll->size)
+		return NULL;
+
+	temp = ll->head;
+
+	if (temp == NULL || index < 0)
+		return NULL;
+
+	while (index > 0){
+		temp = temp->next;
+		if (temp == NULL)
+			return NULL;
+		index--;
+	}
+
+	return temp;
+}
+
+int insertNode(LinkedList *ll, int index, int value){
+
+	ListNode *pre, *cur;
+
+	if (ll == NULL || index < 0 || index > ll->size)
+		return -1;
+
+	// Appending after the last node never needs to walk the list
+	if (index == ll->size)
+		return appendNode(ll, value);
+
+	// If inserting first node, need to update head pointer
+	if (index == 0){
+		cur = ll->head;
+		ll->head = allocNode(ll->pool);
+		ll->head->item = value;
+		ll->head->next = cur;
+		ll->size++;
+		return 0;
+	}
+
+
+	// Find the nodes before and at the target position
+	// Create a new node and reconnect the links
+	if ((pre = findNode(ll, index - 1)) != NULL){
+		cur = pre->next;
+		pre->next = allocNode(ll->pool);
+		pre->next->item = value;
+		pre->next->next = cur;
+		ll->size++;
+		return 0;
+	}
+
+	return -1;
+}
+
+
+int appendNode(LinkedList *ll, int value){
+
+	ListNode *newNode;
+
+	if (ll == NULL)
+		return -1;
+
+	// Link the new node straight after the tail pointer
+	newNode = allocNode(ll->pool);
+	newNode->item = value;
+	newNode->next = NULL;
+
+	if (ll->head == NULL)
+		ll->head = newNode;
+	else
+		ll->tail->next = newNode;
+	ll->tail = newNode;
+	ll->size++;
+	return 0;
+}
+
+
+int removeNode(LinkedList *ll, int index){
+
+	ListNode *pre, *cur;
+
+	// Highest index we can remove is size-1
+	if (ll == NULL || index < 0 || index >= ll->size)
+		return -1;
+
+	// If removing first node, need to update head pointer
+	if (index == 0){
+		cur = ll->head->next;
+		freeNode(ll->pool, ll->head);
+		ll->head = cur;
+		if (cur == NULL)
+			ll->tail = NULL;
+		ll->size--;
+
+		return 0;
+	}
+
+	// Find the nodes before and after the target position
+	// Free the target node and reconnect the links
+	if ((pre = findNode(ll, index - 1)) != NULL){
+
+		if (pre->next == NULL)
+			return -1;
+
+		cur = pre->next;
+		pre->next = cur->next;
+		if (cur == ll->tail)
+			ll->tail = pre;
+		freeNode(ll->pool, cur);
+		ll->size--;
+		return 0;
+	}
+
+	return -1;
+}
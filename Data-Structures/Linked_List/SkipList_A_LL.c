@@ -0,0 +1,517 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section A - Linked List
+Purpose: Sorted linked list indexed by a skip list with span counts, so that
+		 insertSortedLL() finds the insertion point and index in O(log n) */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SKIP_MAX_LEVEL 24	// enough index levels for 4^24 items with p = 1/4
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _listnode{
+	int item;
+	struct _listnode *next;
+} ListNode;
+
+typedef struct _linkedlist{
+	int size;
+	ListNode *head;
+} LinkedList;
+
+typedef struct _skipnode SkipNode;
+
+typedef struct _skiplink{
+	SkipNode *next;
+	int span;			// level-0 steps from this node to next (to the end if next is NULL)
+} SkipLink;
+
+struct _skipnode{
+	ListNode node;		// level 0 is an ordinary ListNode chain
+	int level;			// number of index levels above level 0
+	SkipLink links[];	// links[i] is index level i + 1
+};
+
+typedef struct _skiplist{
+	LinkedList ll;		// level 0 view: ll.head / ll.size work with printList()
+	int level;
+	SkipNode *header;
+} SkipList;
+
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+void initSkipList(SkipList *sl);
+int insertSortedLL(SkipList *sl, int item);
+int removeSortedLL(SkipList *sl, int item);
+int indexOfItem(SkipList *sl, int item);
+ListNode *findSortedNode(SkipList *sl, int index);
+void removeAllSorted(SkipList *sl);
+void benchmarkSortedInsert(int n);
+
+int insertSortedLinear(LinkedList *ll, int item);
+void printList(LinkedList *ll);
+void removeAllItems(LinkedList *ll);
+ListNode *findNode(LinkedList *ll, int index);
+int insertNode(LinkedList *ll, int index, int value);
+
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	SkipList sl;
+	ListNode *node;
+	int c, i, j;
+	c = 1;
+	i = 0;
+	j = -1;
+
+	srand((unsigned)time(NULL));
+
+	//Initialize the skip list as an empty sorted list
+	initSkipList(&sl);
+
+	printf("1: Insert an integer to the sorted linked list:\n");
+	printf("2: Print the index of the most recent input value:\n");
+	printf("3: Remove an integer from the sorted linked list:\n");
+	printf("4: Print the index of an integer:\n");
+	printf("5: Print the integer at an index:\n");
+	printf("6: Print sorted linked list:\n");
+	printf("7: Run the skip list vs linear insertSortedLL benchmark:\n");
+	printf("0: Quit:");
+
+	while (c != 0)
+	{
+		printf("\nPlease input your choice(1-7/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to add to the linked list: ");
+			scanf("%d", &i);
+			j = insertSortedLL(&sl, i);
+			printf("The resulting linked list is: ");
+			printList(&sl.ll);
+			break;
+		case 2:
+			printf("The value %d was added at index %d\n", i, j);
+			break;
+		case 3:
+			printf("Input an integer that you want to remove from the linked list: ");
+			scanf("%d", &i);
+			if (removeSortedLL(&sl, i) == -1)
+				printf("%d is not in the linked list\n", i);
+			printf("The resulting linked list is: ");
+			printList(&sl.ll);
+			break;
+		case 4:
+			printf("Input an integer that you want to find: ");
+			scanf("%d", &i);
+			printf("The value %d is at index %d\n", i, indexOfItem(&sl, i));
+			break;
+		case 5:
+			printf("Input an index: ");
+			scanf("%d", &i);
+			node = findSortedNode(&sl, i);
+			if (node == NULL)
+				printf("Index out of range\n");
+			else
+				printf("The integer at index %d is %d\n", i, node->item);
+			break;
+		case 6:
+			printf("The resulting sorted linked list is: ");
+			printList(&sl.ll);
+			break;
+		case 7:
+			printf("Input the number of random integers to insert: ");
+			scanf("%d", &i);
+			benchmarkSortedInsert(i);
+			break;
+		case 0:
+			removeAllSorted(&sl);
+			free(sl.header);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+
+	}
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static SkipNode *createSkipNode(int level, int item)
+{
+	SkipNode *node = malloc(sizeof(SkipNode) + level * sizeof(SkipLink));
+	int i;
+
+	if (node == NULL)
+		exit(0);
+	node->node.item = item;
+	node->node.next = NULL;
+	node->level = level;
+	for (i = 0; i < level; i++) {
+		node->links[i].next = NULL;
+		node->links[i].span = 0;
+	}
+	return node;
+}
+
+// 확률 1/4로 한 층씩 올라가는 무작위 높이
+static int randomLevel(void)
+{
+	int level = 0;
+	while (level < SKIP_MAX_LEVEL && (rand() & 3) == 0)
+		level++;
+	return level;
+}
+
+void initSkipList(SkipList *sl)
+{
+	sl->header = createSkipNode(SKIP_MAX_LEVEL, 0);
+	sl->level = 0;
+	sl->ll.head = NULL;
+	sl->ll.size = 0;
+}
+
+// 정렬 리스트에 item 삽입
+// - 위층부터 내려오며 위치를 찾고, 지나온 span을 더해 삽입 인덱스(rank)를 구함
+// - 중복이면 -1, 아니면 삽입된 인덱스 반환
+int insertSortedLL(SkipList *sl, int item)
+{
+	SkipNode *update[SKIP_MAX_LEVEL + 1];
+	int rank[SKIP_MAX_LEVEL + 2];
+	SkipNode *x = sl->header;
+	SkipNode *newNode;
+	ListNode *next;
+	int i, level;
+
+	// 인덱스 층: rank[i]는 header부터 update[i]까지의 원소 개수 (header 자신은 0)
+	rank[sl->level + 1] = 0;
+	for (i = sl->level; i >= 1; i--) {
+		rank[i] = rank[i + 1];
+		while (x->links[i - 1].next && x->links[i - 1].next->node.item < item) {
+			rank[i] += x->links[i - 1].span;
+			x = x->links[i - 1].next;
+		}
+		update[i] = x;
+	}
+
+	// 0층(ListNode 체인)에서 마지막 몇 칸 이동
+	rank[0] = rank[1];
+	while ((next = x->node.next) != NULL && next->item < item) {
+		rank[0]++;
+		x = (SkipNode *)next;
+	}
+	if (next && next->item == item)
+		return -1;
+	update[0] = x;
+
+	level = randomLevel();
+	if (level > sl->level) {
+		for (i = sl->level + 1; i <= level; i++) {
+			rank[i] = 0;
+			update[i] = sl->header;
+			update[i]->links[i - 1].span = sl->ll.size;
+		}
+		sl->level = level;
+	}
+
+	newNode = createSkipNode(level, item);
+	newNode->node.next = x->node.next;
+	x->node.next = &newNode->node;
+
+	for (i = 1; i <= level; i++) {
+		newNode->links[i - 1].next = update[i]->links[i - 1].next;
+		update[i]->links[i - 1].next = newNode;
+		newNode->links[i - 1].span = update[i]->links[i - 1].span - (rank[0] - rank[i]);
+		update[i]->links[i - 1].span = (rank[0] - rank[i]) + 1;
+	}
+	// 새 노드보다 높은 층은 건너뛰는 거리만 하나 늘어남
+	for (i = level + 1; i <= sl->level; i++)
+		update[i]->links[i - 1].span++;
+
+	sl->ll.head = sl->header->node.next;
+	sl->ll.size++;
+	return rank[0];
+}
+
+// item 삭제, 삭제된 위치의 인덱스 반환 (없으면 -1)
+int removeSortedLL(SkipList *sl, int item)
+{
+	SkipNode *update[SKIP_MAX_LEVEL + 1];
+	SkipNode *x = sl->header;
+	SkipNode *target;
+	ListNode *next;
+	int i, rank = 0;
+
+	for (i = sl->level; i >= 1; i--) {
+		while (x->links[i - 1].next && x->links[i - 1].next->node.item < item) {
+			rank += x->links[i - 1].span;
+			x = x->links[i - 1].next;
+		}
+		update[i] = x;
+	}
+	while ((next = x->node.next) != NULL && next->item < item) {
+		rank++;
+		x = (SkipNode *)next;
+	}
+	if (next == NULL || next->item != item)
+		return -1;
+
+	target = (SkipNode *)next;
+	x->node.next = target->node.next;
+	for (i = 1; i <= sl->level; i++) {
+		if (update[i]->links[i - 1].next == target) {
+			update[i]->links[i - 1].span += target->links[i - 1].span - 1;
+			update[i]->links[i - 1].next = target->links[i - 1].next;
+		}
+		else {
+			update[i]->links[i - 1].span--;
+		}
+	}
+	free(target);
+
+	while (sl->level > 0 && sl->header->links[sl->level - 1].next == NULL)
+		sl->level--;
+	sl->ll.head = sl->header->node.next;
+	sl->ll.size--;
+	return rank;
+}
+
+// item의 인덱스 (없으면 -1)
+int indexOfItem(SkipList *sl, int item)
+{
+	SkipNode *x = sl->header;
+	ListNode *next;
+	int i, rank = 0;
+
+	for (i = sl->level; i >= 1; i--) {
+		while (x->links[i - 1].next && x->links[i - 1].next->node.item < item) {
+			rank += x->links[i - 1].span;
+			x = x->links[i - 1].next;
+		}
+	}
+	while ((next = x->node.next) != NULL && next->item < item) {
+		rank++;
+		x = (SkipNode *)next;
+	}
+	if (next == NULL || next->item != item)
+		return -1;
+	return rank;
+}
+
+// index번째 노드 - span을 따라 내려가므로 O(log n)
+ListNode *findSortedNode(SkipList *sl, int index)
+{
+	SkipNode *x = sl->header;
+	int i, traversed = 0;	// x 까지 지나온 원소 수 (header는 0)
+
+	if (index < 0 || index >= sl->ll.size)
+		return NULL;
+
+	for (i = sl->level; i >= 1; i--) {
+		while (x->links[i - 1].next && traversed + x->links[i - 1].span <= index + 1) {
+			traversed += x->links[i - 1].span;
+			x = x->links[i - 1].next;
+		}
+	}
+	while (traversed < index + 1) {
+		x = (SkipNode *)x->node.next;
+		traversed++;
+	}
+	return &x->node;
+}
+
+void removeAllSorted(SkipList *sl)
+{
+	ListNode *cur = sl->header->node.next;
+	ListNode *tmp;
+	int i;
+
+	// 모든 노드는 0층 체인에 있으므로 체인만 따라가며 해제
+	while (cur != NULL) {
+		tmp = cur->next;
+		free((SkipNode *)cur);
+		cur = tmp;
+	}
+	sl->header->node.next = NULL;
+	for (i = 0; i < SKIP_MAX_LEVEL; i++) {
+		sl->header->links[i].next = NULL;
+		sl->header->links[i].span = 0;
+	}
+	sl->level = 0;
+	sl->ll.head = NULL;
+	sl->ll.size = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 같은 무작위 값 n개를 기존 방식(선형 탐색 + insertNode)과 skip list에 삽입해 비교
+void benchmarkSortedInsert(int n)
+{
+	SkipList sl;
+	LinkedList ll;
+	int *values;
+	clock_t start;
+	double linearTime, skipTime;
+	int i, mismatch = 0;
+	ListNode *a, *b;
+
+	if (n <= 0)
+		return;
+	values = malloc(sizeof(int) * n);
+	if (values == NULL)
+		return;
+	for (i = 0; i < n; i++)
+		values[i] = rand();
+
+	ll.head = NULL;
+	ll.size = 0;
+	start = clock();
+	for (i = 0; i < n; i++)
+		insertSortedLinear(&ll, values[i]);
+	linearTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	initSkipList(&sl);
+	start = clock();
+	for (i = 0; i < n; i++)
+		insertSortedLL(&sl, values[i]);
+	skipTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	// 두 리스트의 0층이 같은지 확인
+	a = ll.head;
+	b = sl.ll.head;
+	while (a && b) {
+		if (a->item != b->item)
+			mismatch = 1;
+		a = a->next;
+		b = b->next;
+	}
+	if (mismatch || a || b || ll.size != sl.ll.size)
+		printf("The two sorted lists differ!\n");
+
+	printf("linear insertSortedLL: %.3f s (%.1f ns/insert)\n", linearTime, linearTime * 1e9 / n);
+	printf("skip list:             %.3f s (%.1f ns/insert)\n", skipTime, skipTime * 1e9 / n);
+
+	removeAllItems(&ll);
+	removeAllSorted(&sl);
+	free(sl.header);
+	free(values);
+}
+
+// Original Q1 insertSortedLL on a plain LinkedList, kept as the benchmark baseline
+int insertSortedLinear(LinkedList *ll, int item)
+{
+	ListNode* cursor = ll->head;
+	int idx = 0;
+
+	while (cursor && cursor->item < item) {
+		cursor = cursor->next;
+		idx++;
+	}
+	if (cursor && cursor->item == item)
+		return -1;
+	if (insertNode(ll, idx, item) == -1)
+		return -1;
+	return idx;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void printList(LinkedList *ll){
+
+	ListNode *cur;
+	if (ll == NULL)
+		return;
+	cur = ll->head;
+
+	if (cur == NULL)
+		printf("Empty");
+	while (cur != NULL)
+	{
+		printf("%d ", cur->item);
+		cur = cur->next;
+	}
+	printf("\n");
+}
+
+
+void removeAllItems(LinkedList *ll)
+{
+	ListNode *cur = ll->head;
+	ListNode *tmp;
+
+	while (cur != NULL){
+		tmp = cur->next;
+		free(cur);
+		cur = tmp;
+	}
+	ll->head = NULL;
+	ll->size = 0;
+}
+
+
+ListNode *findNode(LinkedList *ll, int index){
+
+	ListNode *temp;
+
+	if (ll == NULL || index < 0 || index >= ll->size)
+		return NULL;
+
+	temp = ll->head;
+
+	if (temp == NULL || index < 0)
+		return NULL;
+
+	while (index > 0){
+		temp = temp->next;
+		if (temp == NULL)
+			return NULL;
+		index--;
+	}
+
+	return temp;
+}
+
+int insertNode(LinkedList *ll, int index, int value){
+
+	ListNode *pre, *cur;
+
+	if (ll == NULL || index < 0 || index > ll->size + 1)
+		return -1;
+
+	// If empty list or inserting first node, need to update head pointer
+	if (ll->head == NULL || index == 0){
+		cur = ll->head;
+		ll->head = malloc(sizeof(ListNode));
+		ll->head->item = value;
+		ll->head->next = cur;
+		ll->size++;
+		return 0;
+	}
+
+
+	// Find the nodes before and at the target position
+	// Create a new node and reconnect the links
+	if ((pre = findNode(ll, index - 1)) != NULL){
+		cur = pre->next;
+		pre->next = malloc(sizeof(ListNode));
+		pre->next->item = value;
+		pre->next->next = cur;
+		ll->size++;
+		return 0;
+	}
+
+	return -1;
+}
@@ -0,0 +1,567 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section A - Linked List
+Purpose: Unrolled linked list that packs many ints into one cache-line block,
+		 with the Section A operations and a traversal benchmark */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BLOCK_CAPACITY 13	// 8 (next) + 4 (count) + 13 * 4 (items) = 64 bytes
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _listnode{
+	int item;
+	struct _listnode *next;
+} ListNode;			// node-per-int layout, only used by the benchmark
+
+typedef struct _listblock{
+	struct _listblock *next;
+	int count;
+	int items[BLOCK_CAPACITY];
+} ListBlock;
+
+typedef struct _unrolledlist{
+	int size;
+	ListBlock *head;
+} UnrolledList;
+
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+int insertSortedLL(UnrolledList *ll, int item);
+void moveOddItemsToBack(UnrolledList *ll);
+void moveEvenItemsToBack(UnrolledList *ll);
+void frontBackSplitLinkedList(UnrolledList *ll, UnrolledList *resultFrontList, UnrolledList *resultBackList);
+void RecursiveReverse(ListBlock **ptrHead);
+void benchmarkTraversal(int n, int passes);
+
+void printList(UnrolledList *ll);
+void printBlocks(UnrolledList *ll);
+void removeAllItems(UnrolledList *ll);
+ListBlock *findNode(UnrolledList *ll, int index, int *offset);
+int insertNode(UnrolledList *ll, int index, int value);
+int removeNode(UnrolledList *ll, int index);
+
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	UnrolledList ll, resultFrontList, resultBackList;
+	ListBlock *block;
+	int c, i, j, offset;
+	c = 1;
+
+	//Initialize the lists as empty unrolled lists
+	ll.head = NULL;
+	ll.size = 0;
+	resultFrontList.head = NULL;
+	resultFrontList.size = 0;
+	resultBackList.head = NULL;
+	resultBackList.size = 0;
+
+	printf("1: Insert an integer to the sorted list:\n");
+	printf("2: Insert an integer at an index:\n");
+	printf("3: Remove the integer at an index:\n");
+	printf("4: Find the integer at an index:\n");
+	printf("5: Move all odd integers to the back of the list:\n");
+	printf("6: Move all even integers to the back of the list:\n");
+	printf("7: Split the list into frontList and backList:\n");
+	printf("8: Reverse the list:\n");
+	printf("9: Print the block layout of the list:\n");
+	printf("10: Run the traversal benchmark:\n");
+	printf("0: Quit:\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-10/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to add to the sorted list: ");
+			scanf("%d", &i);
+			j = insertSortedLL(&ll, i);
+			printf("The value %d was added at index %d\n", i, j);
+			printf("The resulting list is: ");
+			printList(&ll);
+			break;
+		case 2:
+			printf("Input the index and the integer: ");
+			scanf("%d %d", &j, &i);
+			if (insertNode(&ll, j, i) == -1)
+				printf("Index out of range\n");
+			printf("The resulting list is: ");
+			printList(&ll);
+			break;
+		case 3:
+			printf("Input the index that you want to remove: ");
+			scanf("%d", &j);
+			if (removeNode(&ll, j) == -1)
+				printf("Index out of range\n");
+			printf("The resulting list is: ");
+			printList(&ll);
+			break;
+		case 4:
+			printf("Input the index that you want to find: ");
+			scanf("%d", &j);
+			block = findNode(&ll, j, &offset);
+			if (block == NULL)
+				printf("Index out of range\n");
+			else
+				printf("The integer at index %d is %d\n", j, block->items[offset]);
+			break;
+		case 5:
+			moveOddItemsToBack(&ll);
+			printf("The resulting list after moving odd integers to the back is: ");
+			printList(&ll);
+			break;
+		case 6:
+			moveEvenItemsToBack(&ll);
+			printf("The resulting list after moving even integers to the back is: ");
+			printList(&ll);
+			break;
+		case 7:
+			frontBackSplitLinkedList(&ll, &resultFrontList, &resultBackList);
+			printf("Front list: ");
+			printList(&resultFrontList);
+			printf("Back list: ");
+			printList(&resultBackList);
+			removeAllItems(&resultFrontList);
+			removeAllItems(&resultBackList);
+			break;
+		case 8:
+			RecursiveReverse(&(ll.head));
+			printf("The resulting list after reversing is: ");
+			printList(&ll);
+			break;
+		case 9:
+			printBlocks(&ll);
+			break;
+		case 10:
+			printf("Input the list size and the number of passes: ");
+			scanf("%d %d", &i, &j);
+			benchmarkTraversal(i, j);
+			break;
+		case 0:
+			removeAllItems(&ll);
+			removeAllItems(&resultFrontList);
+			removeAllItems(&resultBackList);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 정렬된 unrolled 리스트에 item 삽입
+// - 블록의 마지막 값만 보고 블록 단위로 건너뛰므로 포인터 추적은 n / BLOCK_CAPACITY번
+// - 중복이면 -1, 아니면 삽입된 인덱스 반환
+int insertSortedLL(UnrolledList *ll, int item)
+{
+	ListBlock *block = ll->head;
+	int idx = 0;
+	int i;
+
+	// item이 들어갈 블록 찾기: 마지막 값이 item보다 작은 블록은 통째로 건너뜀
+	while (block && block->next && block->items[block->count - 1] < item) {
+		idx += block->count;
+		block = block->next;
+	}
+
+	// 블록 안에서 위치 찾기
+	i = 0;
+	if (block) {
+		while (i < block->count && block->items[i] < item)
+			i++;
+		if (i < block->count && block->items[i] == item)
+			return -1;
+	}
+
+	if (insertNode(ll, idx + i, item) == -1)
+		return -1;
+	return idx + i;
+}
+
+// keepOdd가 1이면 짝수를 앞으로(홀수를 뒤로), 0이면 홀수를 앞으로 모음
+// - 블록 구조는 그대로 두고 값만 다시 씀 (순서는 안정적으로 유지)
+// - 앞으로 올 값은 제자리에서 당겨 쓰고, 뒤로 갈 값만 임시 배열에 모음
+static void partitionItems(UnrolledList *ll, int keepOdd)
+{
+	ListBlock *readBlock, *writeBlock;
+	int *moved;
+	int movedCount = 0;
+	int i, w, value, goesBack;
+
+	if (ll->size <= 1)
+		return;
+	moved = malloc(sizeof(int) * ll->size);
+	if (moved == NULL)
+		return;
+
+	writeBlock = ll->head;
+	w = 0;
+	for (readBlock = ll->head; readBlock; readBlock = readBlock->next) {
+		for (i = 0; i < readBlock->count; i++) {
+			value = readBlock->items[i];
+			goesBack = (value % 2 != 0) == keepOdd;
+			if (goesBack) {
+				moved[movedCount++] = value;
+				continue;
+			}
+			if (w == writeBlock->count) {
+				writeBlock = writeBlock->next;
+				w = 0;
+			}
+			writeBlock->items[w++] = value;
+		}
+	}
+
+	for (i = 0; i < movedCount; i++) {
+		if (w == writeBlock->count) {
+			writeBlock = writeBlock->next;
+			w = 0;
+		}
+		writeBlock->items[w++] = moved[i];
+	}
+	free(moved);
+}
+
+void moveOddItemsToBack(UnrolledList *ll)
+{
+	partitionItems(ll, 1);
+}
+
+void moveEvenItemsToBack(UnrolledList *ll)
+{
+	partitionItems(ll, 0);
+}
+
+// 리스트를 앞/뒤로 나눔 (홀수 개면 앞쪽이 하나 더 많음), 원본 ll은 비워짐
+// - 경계가 블록 중간에 걸리면 그 블록만 둘로 쪼갬
+void frontBackSplitLinkedList(UnrolledList *ll, UnrolledList *resultFrontList, UnrolledList *resultBackList)
+{
+	ListBlock *block, *rest;
+	int frontsize, offset, i;
+
+	removeAllItems(resultFrontList);
+	removeAllItems(resultBackList);
+	if (!ll || !ll->head)
+		return;
+
+	frontsize = (ll->size + 1) / 2;
+	resultFrontList->head = ll->head;
+	resultFrontList->size = frontsize;
+	resultBackList->size = ll->size - frontsize;
+
+	// 앞 리스트의 마지막 원소가 들어 있는 블록
+	block = findNode(ll, frontsize - 1, &offset);
+	rest = block->next;
+
+	if (offset + 1 < block->count) {
+		ListBlock *tailPart = malloc(sizeof(ListBlock));
+		if (tailPart == NULL)
+			exit(0);
+		tailPart->count = block->count - (offset + 1);
+		for (i = 0; i < tailPart->count; i++)
+			tailPart->items[i] = block->items[offset + 1 + i];
+		tailPart->next = rest;
+		block->count = offset + 1;
+		rest = tailPart;
+	}
+	block->next = NULL;
+	resultBackList->head = rest;
+
+	ll->head = NULL;
+	ll->size = 0;
+}
+
+// 블록 순서를 재귀적으로 뒤집고, 각 블록 안의 값도 뒤집음
+void RecursiveReverse(ListBlock **ptrHead)
+{
+	ListBlock *first, *rest;
+	int i, tmp;
+
+	if (!ptrHead || !*ptrHead)
+		return;
+
+	first = *ptrHead;
+	for (i = 0; i < first->count / 2; i++) {
+		tmp = first->items[i];
+		first->items[i] = first->items[first->count - 1 - i];
+		first->items[first->count - 1 - i] = tmp;
+	}
+	if (first->next == NULL)
+		return;
+
+	rest = first->next;
+	RecursiveReverse(&rest);
+
+	first->next->next = first;
+	first->next = NULL;
+	*ptrHead = rest;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 같은 n개의 값을 노드당 int 1개 리스트와 unrolled 리스트에 담고
+// passes번 전체 순회(합계)하는 시간을 비교
+void benchmarkTraversal(int n, int passes)
+{
+	UnrolledList ul;
+	ListNode *head = NULL, *tail = NULL, *node, *tmp;
+	ListBlock *block, *lastBlock = NULL;
+	clock_t start;
+	double nodeTime, blockTime;
+	long long nodeSum = 0, blockSum = 0;
+	int i, p;
+
+	if (n <= 0 || passes <= 0)
+		return;
+
+	ul.head = NULL;
+	ul.size = 0;
+	for (i = 0; i < n; i++) {
+		node = malloc(sizeof(ListNode));
+		if (node == NULL)
+			exit(0);
+		node->item = i;
+		node->next = NULL;
+		if (head == NULL)
+			head = node;
+		else
+			tail->next = node;
+		tail = node;
+
+		// 마지막 블록을 꽉 채워 가며 추가 (insertNode는 매번 앞에서부터 블록을 찾으므로 쓰지 않음)
+		if (lastBlock == NULL || lastBlock->count == BLOCK_CAPACITY) {
+			block = malloc(sizeof(ListBlock));
+			if (block == NULL)
+				exit(0);
+			block->next = NULL;
+			block->count = 0;
+			if (lastBlock == NULL)
+				ul.head = block;
+			else
+				lastBlock->next = block;
+			lastBlock = block;
+		}
+		lastBlock->items[lastBlock->count++] = i;
+		ul.size++;
+	}
+
+	start = clock();
+	for (p = 0; p < passes; p++)
+		for (node = head; node; node = node->next)
+			nodeSum += node->item;
+	nodeTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (p = 0; p < passes; p++)
+		for (block = ul.head; block; block = block->next)
+			for (i = 0; i < block->count; i++)
+				blockSum += block->items[i];
+	blockTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	printf("node-per-int: %.3f s (%.1f M items/s)\n", nodeTime,
+		nodeTime > 0 ? (double)n * passes / nodeTime / 1e6 : 0.0);
+	printf("unrolled:     %.3f s (%.1f M items/s)\n", blockTime,
+		blockTime > 0 ? (double)n * passes / blockTime / 1e6 : 0.0);
+	if (nodeSum != blockSum)
+		printf("checksum mismatch!\n");
+
+	while (head) {
+		tmp = head->next;
+		free(head);
+		head = tmp;
+	}
+	removeAllItems(&ul);
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+void printList(UnrolledList *ll){
+
+	ListBlock *cur;
+	int i;
+	if (ll == NULL)
+		return;
+	cur = ll->head;
+
+	if (cur == NULL)
+		printf("Empty");
+	while (cur != NULL)
+	{
+		for (i = 0; i < cur->count; i++)
+			printf("%d ", cur->items[i]);
+		cur = cur->next;
+	}
+	printf("\n");
+}
+
+void printBlocks(UnrolledList *ll){
+
+	ListBlock *cur;
+	int i;
+	if (ll == NULL)
+		return;
+
+	printf("%d item(s): ", ll->size);
+	for (cur = ll->head; cur != NULL; cur = cur->next)
+	{
+		printf("[");
+		for (i = 0; i < cur->count; i++)
+			printf(i ? " %d" : "%d", cur->items[i]);
+		printf("] ");
+	}
+	printf("\n");
+}
+
+
+void removeAllItems(UnrolledList *ll)
+{
+	ListBlock *cur = ll->head;
+	ListBlock *tmp;
+
+	while (cur != NULL){
+		tmp = cur->next;
+		free(cur);
+		cur = tmp;
+	}
+	ll->head = NULL;
+	ll->size = 0;
+}
+
+
+// index번째 값이 들어 있는 블록을 반환하고, 블록 안의 위치를 *offset에 기록
+ListBlock *findNode(UnrolledList *ll, int index, int *offset){
+
+	ListBlock *temp;
+
+	if (ll == NULL || index < 0 || index >= ll->size)
+		return NULL;
+
+	temp = ll->head;
+	while (temp != NULL && index >= temp->count){
+		index -= temp->count;
+		temp = temp->next;
+	}
+	if (temp == NULL)
+		return NULL;
+
+	*offset = index;
+	return temp;
+}
+
+int insertNode(UnrolledList *ll, int index, int value){
+
+	ListBlock *block, *newBlock;
+	int offset, i, half;
+
+	if (ll == NULL || index < 0 || index > ll->size)
+		return -1;
+
+	// Empty list: start the first block
+	if (ll->head == NULL){
+		ll->head = malloc(sizeof(ListBlock));
+		if (ll->head == NULL)
+			exit(0);
+		ll->head->next = NULL;
+		ll->head->count = 1;
+		ll->head->items[0] = value;
+		ll->size++;
+		return 0;
+	}
+
+	// Find the block that holds the target position
+	// (appending goes to the end of the last block)
+	block = ll->head;
+	offset = index;
+	while (offset > block->count || (offset == block->count && block->next != NULL && block->count == BLOCK_CAPACITY)){
+		offset -= block->count;
+		block = block->next;
+	}
+
+	// Full block: move its upper half into a new block right after it
+	if (block->count == BLOCK_CAPACITY){
+		newBlock = malloc(sizeof(ListBlock));
+		if (newBlock == NULL)
+			exit(0);
+		half = BLOCK_CAPACITY / 2;
+		newBlock->count = BLOCK_CAPACITY - half;
+		for (i = 0; i < newBlock->count; i++)
+			newBlock->items[i] = block->items[half + i];
+		newBlock->next = block->next;
+		block->next = newBlock;
+		block->count = half;
+
+		if (offset > half){
+			offset -= half;
+			block = newBlock;
+		}
+	}
+
+	for (i = block->count; i > offset; i--)
+		block->items[i] = block->items[i - 1];
+	block->items[offset] = value;
+	block->count++;
+	ll->size++;
+	return 0;
+}
+
+
+int removeNode(UnrolledList *ll, int index){
+
+	ListBlock *block, *pre, *next;
+	int offset, i;
+
+	// Highest index we can remove is size-1
+	if (ll == NULL || index < 0 || index >= ll->size)
+		return -1;
+
+	pre = NULL;
+	block = ll->head;
+	offset = index;
+	while (offset >= block->count){
+		offset -= block->count;
+		pre = block;
+		block = block->next;
+	}
+
+	for (i = offset; i < block->count - 1; i++)
+		block->items[i] = block->items[i + 1];
+	block->count--;
+	ll->size--;
+
+	// Drop an emptied block
+	if (block->count == 0){
+		if (pre == NULL)
+			ll->head = block->next;
+		else
+			pre->next = block->next;
+		free(block);
+		return 0;
+	}
+
+	// Merge with the next block when both fit into one, so blocks stay dense
+	next = block->next;
+	if (next != NULL && block->count + next->count <= BLOCK_CAPACITY){
+		for (i = 0; i < next->count; i++)
+			block->items[block->count + i] = next->items[i];
+		block->count += next->count;
+		block->next = next->next;
+		free(next);
+	}
+	return 0;
+}
@@ -0,0 +1,435 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section C - Stack and Queue
+Purpose: Contiguous array Stack with geometric growth, pushN/popN batch operations
+		 and an inline small buffer, plus Q2/Q3/Q6/Q7 ported onto it */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MIN_INT -1000
+#define STACK_INLINE_CAPACITY 32	// shallow stacks never touch the heap
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct stack
+{
+	int *items;			// inlineItems until the stack outgrows it
+	int size;
+	int capacity;
+	int inlineItems[STACK_INLINE_CAPACITY];
+} Stack;	// do not copy a Stack by value: items may point into itself
+
+typedef struct _listnode
+{
+	int item;
+	struct _listnode *next;
+} ListNode;	// list-backed stack, only used by the benchmark
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+void removeEvenValues(Stack *s);
+int isStackPairwiseConsecutive(Stack *s);
+void removeUntil(Stack *s, int value);
+int balanced(char *expression);
+
+void initStack(Stack *s);
+void push(Stack *s, int item);
+int pop(Stack *s);
+int peek(Stack *s);
+int isEmptyStack(Stack *s);
+void pushN(Stack *s, const int *values, int n);
+int popN(Stack *s, int *out, int n);
+void removeAllItemsFromStack(Stack *s);
+void destroyStack(Stack *s);
+void printStack(Stack *s);
+
+void benchmarkStack(int n, int rounds);
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	char str[256];
+	int c, i, j, n;
+	int *buffer;
+	Stack s;
+
+	c = 1;
+
+	// Initalize the stack as an empty stack
+	initStack(&s);
+
+	printf("1: Push an integer into the stack:\n");
+	printf("2: Pop an integer from the stack:\n");
+	printf("3: Push several integers into the stack:\n");
+	printf("4: Pop several integers from the stack:\n");
+	printf("5: Remove all even values from the stack:\n");
+	printf("6: Check whether the stack is pairwise consecutive:\n");
+	printf("7: Pop all values until the chosen value is on top:\n");
+	printf("8: Check whether an expression of ()[]{} is balanced:\n");
+	printf("9: Run the array vs linked list stack benchmark:\n");
+	printf("0: Quit:\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1-9/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to push into the stack: ");
+			scanf("%d", &i);
+			push(&s, i);
+			printf("The resulting stack is: ");
+			printStack(&s);
+			break;
+		case 2:
+			if (isEmptyStack(&s))
+				printf("The stack is empty\n");
+			else
+				printf("Popped %d\n", pop(&s));
+			printf("The resulting stack is: ");
+			printStack(&s);
+			break;
+		case 3:
+			printf("Input the number of integers followed by the integers: ");
+			scanf("%d", &n);
+			if (n <= 0)
+				break;
+			buffer = malloc(sizeof(int) * n);
+			if (buffer == NULL)
+				break;
+			for (i = 0; i < n; i++)
+				scanf("%d", &buffer[i]);
+			pushN(&s, buffer, n);
+			free(buffer);
+			printf("The resulting stack is: ");
+			printStack(&s);
+			break;
+		case 4:
+			printf("Input the number of integers to pop: ");
+			scanf("%d", &n);
+			if (n <= 0)
+				break;
+			buffer = malloc(sizeof(int) * n);
+			if (buffer == NULL)
+				break;
+			j = popN(&s, buffer, n);
+			printf("Popped: ");
+			for (i = 0; i < j; i++)
+				printf("%d ", buffer[i]);
+			printf("\n");
+			free(buffer);
+			printf("The resulting stack is: ");
+			printStack(&s);
+			break;
+		case 5:
+			removeEvenValues(&s);
+			printf("The resulting stack after removing even integers is: ");
+			printStack(&s);
+			break;
+		case 6:
+			if (isStackPairwiseConsecutive(&s))
+				printf("The stack is pairwise consecutive.\n");
+			else
+				printf("The stack is not pairwise consecutive.\n");
+			break;
+		case 7:
+			printf("Input the chosen value: ");
+			scanf("%d", &i);
+			removeUntil(&s, i);
+			printf("The resulting stack is: ");
+			printStack(&s);
+			break;
+		case 8:
+			printf("Enter expressions without spaces to check whether it is balanced or not: ");
+			scanf("%255s", str);
+			if (balanced(str))
+				printf("not balanced!\n");
+			else
+				printf("balanced!\n");
+			break;
+		case 9:
+			printf("Input the stack depth and the number of rounds: ");
+			scanf("%d %d", &i, &j);
+			benchmarkStack(i, j);
+			break;
+		case 0:
+			destroyStack(&s);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 짝수를 제거하고 나머지 순서는 유지 - 배열을 제자리에서 앞으로 당겨 채움 (O(n))
+void removeEvenValues(Stack *s)
+{
+	int r, w = 0;
+
+	for (r = 0; r < s->size; r++) {
+		if (s->items[r] % 2 != 0)
+			s->items[w++] = s->items[r];
+	}
+	s->size = w;
+}
+
+// top부터 두 개씩 짝지어 차이가 1인지 확인
+// - 배열에서 바로 읽으므로 pop할 필요가 없고 스택도 그대로 남음
+int isStackPairwiseConsecutive(Stack *s)
+{
+	int i, diff;
+
+	if (s->size % 2 == 1)
+		return 0;
+	for (i = s->size - 1; i > 0; i -= 2) {
+		diff = s->items[i] - s->items[i - 1];
+		if (diff != 1 && diff != -1)
+			return 0;
+	}
+	return 1;
+}
+
+// value가 top에 올 때까지 위에서부터 pop (value 자신은 남김)
+// - top에서 아래로 value의 첫 위치를 찾고 size만 줄이면 됨
+// - value가 없으면 스택을 그대로 둠
+void removeUntil(Stack *s, int value)
+{
+	int i;
+
+	for (i = s->size - 1; i >= 0; i--) {
+		if (s->items[i] == value) {
+			s->size = i + 1;
+			return;
+		}
+	}
+}
+
+// 괄호 짝 검사 - 여는 괄호만 배열 스택에 쌓음 (깊이 32까지는 힙 할당 없음)
+// - 균형이면 0, 아니면 1
+int balanced(char *expression)
+{
+	Stack s;
+	int result = 0;
+	char opening;
+
+	initStack(&s);
+	while (*expression) {
+		if (*expression == '(' || *expression == '[' || *expression == '{')
+			push(&s, *expression);
+		else {
+			if (isEmptyStack(&s)) {
+				result = 1;
+				break;
+			}
+			opening = pop(&s);
+			if (abs(opening - *expression) > 2) {
+				result = 1;
+				break;
+			}
+		}
+		expression++;
+	}
+	if (result == 0 && !isEmptyStack(&s))
+		result = 1;
+	destroyStack(&s);
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void initStack(Stack *s)
+{
+	s->items = s->inlineItems;
+	s->size = 0;
+	s->capacity = STACK_INLINE_CAPACITY;
+}
+
+// 최소 need개가 들어가도록 용량을 두 배씩 늘림
+static void reserveStack(Stack *s, int need)
+{
+	int newCapacity = s->capacity;
+	int *newItems;
+
+	if (need <= s->capacity)
+		return;
+	while (newCapacity < need)
+		newCapacity *= 2;
+
+	newItems = malloc(sizeof(int) * newCapacity);
+	if (newItems == NULL)
+		exit(0);
+	memcpy(newItems, s->items, sizeof(int) * s->size);
+	if (s->items != s->inlineItems)
+		free(s->items);
+	s->items = newItems;
+	s->capacity = newCapacity;
+}
+
+void push(Stack *s, int item)
+{
+	if (s->size == s->capacity)
+		reserveStack(s, s->size + 1);
+	s->items[s->size++] = item;
+}
+
+int pop(Stack *s)
+{
+	if (!isEmptyStack(s))
+		return s->items[--s->size];
+	return MIN_INT;
+}
+
+int peek(Stack *s)
+{
+	if (isEmptyStack(s))
+		return MIN_INT;
+	return s->items[s->size - 1];
+}
+
+int isEmptyStack(Stack *s)
+{
+	if (s->size == 0)
+		return 1;
+	else
+		return 0;
+}
+
+// values[0]부터 차례로 push한 것과 같음 (values[n-1]이 새 top) - 용량 확보와 복사를 한 번에
+void pushN(Stack *s, const int *values, int n)
+{
+	if (n <= 0)
+		return;
+	reserveStack(s, s->size + n);
+	memcpy(s->items + s->size, values, sizeof(int) * n);
+	s->size += n;
+}
+
+// 최대 n개를 pop해서 out에 pop된 순서(top이 out[0])로 담고, 실제 pop한 개수를 반환
+int popN(Stack *s, int *out, int n)
+{
+	int i;
+
+	if (n > s->size)
+		n = s->size;
+	for (i = 0; i < n; i++)
+		out[i] = s->items[s->size - 1 - i];
+	s->size -= n;
+	return n;
+}
+
+// Emptying keeps the current buffer for reuse
+void removeAllItemsFromStack(Stack *s)
+{
+	if (s == NULL)
+		return;
+	s->size = 0;
+}
+
+void destroyStack(Stack *s)
+{
+	if (s->items != s->inlineItems)
+		free(s->items);
+	initStack(s);
+}
+
+void printStack(Stack *s)
+{
+	int i;
+
+	if (s->size == 0)
+		printf("Empty");
+	for (i = s->size - 1; i >= 0; i--)
+		printf("%d ", s->items[i]);
+	printf("\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 같은 push/pop 패턴을 연결 리스트 스택(매번 malloc/free)과 배열 스택에 돌려 비교
+// - 깊이 n까지 push, 전부 pop 을 rounds번 반복 + 같은 양을 pushN/popN으로 한 번 더
+void benchmarkStack(int n, int rounds)
+{
+	ListNode *top = NULL, *node;
+	Stack s;
+	int *values, *out;
+	clock_t start;
+	double listTime, arrayTime, batchTime;
+	long long ops, listSum = 0, arraySum = 0, batchSum = 0;
+	int r, i;
+
+	if (n <= 0 || rounds <= 0)
+		return;
+	values = malloc(sizeof(int) * n);
+	out = malloc(sizeof(int) * n);
+	if (values == NULL || out == NULL) {
+		free(values);
+		free(out);
+		return;
+	}
+	for (i = 0; i < n; i++)
+		values[i] = i;
+	ops = (long long)rounds * n * 2;
+
+	start = clock();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < n; i++) {
+			node = malloc(sizeof(ListNode));
+			if (node == NULL)
+				exit(0);
+			node->item = i;
+			node->next = top;
+			top = node;
+		}
+		while (top) {
+			node = top;
+			listSum += node->item;
+			top = node->next;
+			free(node);
+		}
+	}
+	listTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	initStack(&s);
+	start = clock();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < n; i++)
+			push(&s, i);
+		while (!isEmptyStack(&s))
+			arraySum += pop(&s);
+	}
+	arrayTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (r = 0; r < rounds; r++) {
+		pushN(&s, values, n);
+		popN(&s, out, n);
+		batchSum += out[0];
+	}
+	batchTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+	destroyStack(&s);
+	free(values);
+	free(out);
+
+	if (listSum != arraySum || batchSum != (long long)rounds * (n - 1))
+		printf("checksum mismatch!\n");
+	printf("linked list push/pop: %.3f s (%.1f M ops/s)\n", listTime,
+		listTime > 0 ? ops / listTime / 1e6 : 0.0);
+	printf("array push/pop:       %.3f s (%.1f M ops/s)\n", arrayTime,
+		arrayTime > 0 ? ops / arrayTime / 1e6 : 0.0);
+	printf("array pushN/popN:     %.3f s (%.1f M items/s)\n", batchTime,
+		batchTime > 0 ? ops / batchTime / 1e6 : 0.0);
+}
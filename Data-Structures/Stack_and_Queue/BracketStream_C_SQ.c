@@ -0,0 +1,474 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section C - Stack and Queue
+Purpose: Streaming balanced() for multi-megabyte expressions - SIMD block scan
+		 (AVX2/SSE2, scalar fallback) that skips non-bracket bytes, a 2-bit packed
+		 depth stack, chunked input and the byte offset of the first mismatch */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+#define CHUNK_SIZE 65536	// bytes read from a file per feedMatcher() call
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// Opening brackets are kept as 2-bit codes, four per byte: '(' = 0, '[' = 1, '{' = 2
+typedef struct _bracketmatcher
+{
+	unsigned char *stack;
+	long long depth;		// number of unmatched opening brackets
+	long long capacity;		// in entries (4 per byte)
+	long long offset;		// bytes consumed so far
+	long long errorOffset;	// byte offset of the first mismatch, -1 if none yet
+} BracketMatcher;
+
+typedef struct _listnode
+{
+	int item;
+	struct _listnode *next;
+} ListNode;	// list-backed stack, only used by the benchmark
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+int balanced(char *expression);
+
+void initMatcher(BracketMatcher *m);
+int feedMatcher(BracketMatcher *m, const char *chunk, long long len);
+int finishMatcher(BracketMatcher *m);
+void destroyMatcher(BracketMatcher *m);
+int balancedFile(const char *path, long long *errorOffset);
+
+void benchmarkBalanced(int megabytes);
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	char str[256], path[256];
+	int c, i;
+	long long errorOffset;
+	BracketMatcher m;
+
+	c = 1;
+	str[0] = '\0';
+
+	printf("1: Enter a string:\n");
+	printf("2: Check whether expressions comprised of the characters ()[]{} is balanced:\n");
+	printf("3: Check whether a file is balanced (streamed in chunks):\n");
+	printf("4: Run the streaming vs linked list stack benchmark:\n");
+	printf("0: Quit:\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1/2/3/4/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Enter expressions without spaces to check whether it is balanced or not: ");
+			scanf("%255s", str);
+			break;
+		case 2:
+			initMatcher(&m);
+			feedMatcher(&m, str, strlen(str));
+			if (finishMatcher(&m))
+				printf("not balanced! (first mismatch at byte %lld)\n", m.errorOffset);
+			else
+				printf("balanced!\n");
+			destroyMatcher(&m);
+			break;
+		case 3:
+			printf("Enter the file path: ");
+			scanf("%255s", path);
+			i = balancedFile(path, &errorOffset);
+			if (i == -1)
+				printf("Cannot read %s\n", path);
+			else if (i)
+				printf("not balanced! (first mismatch at byte %lld)\n", errorOffset);
+			else
+				printf("balanced!\n");
+			break;
+		case 4:
+			printf("Input the expression size in megabytes: ");
+			scanf("%d", &i);
+			benchmarkBalanced(i);
+			break;
+		case 0:
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// Same contract as Q7: 0 if balanced, 1 otherwise. Characters other than
+// ()[]{} are skipped instead of being treated as closing brackets.
+int balanced(char *expression)
+{
+	BracketMatcher m;
+	int result;
+
+	initMatcher(&m);
+	feedMatcher(&m, expression, strlen(expression));
+	result = finishMatcher(&m);
+	destroyMatcher(&m);
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 바이트별 분류표: 0 = 괄호 아님, 1~3 = 여는 괄호 (코드 + 1), 4~6 = 닫는 괄호 (코드 + 4)
+static const unsigned char bracketClass[256] = {
+	['('] = 1, ['['] = 2, ['{'] = 3,
+	[')'] = 4, [']'] = 5, ['}'] = 6
+};
+
+void initMatcher(BracketMatcher *m)
+{
+	m->stack = NULL;
+	m->depth = 0;
+	m->capacity = 0;
+	m->offset = 0;
+	m->errorOffset = -1;
+}
+
+void destroyMatcher(BracketMatcher *m)
+{
+	free(m->stack);
+	initMatcher(m);
+}
+
+static void pushCode(BracketMatcher *m, int code)
+{
+	long long newCapacity;
+	unsigned char *newStack;
+	int shift;
+
+	if (m->depth == m->capacity) {
+		newCapacity = m->capacity ? m->capacity * 2 : 256;
+		newStack = realloc(m->stack, newCapacity / 4);
+		if (newStack == NULL)
+			exit(0);
+		m->stack = newStack;
+		m->capacity = newCapacity;
+	}
+	shift = (m->depth & 3) * 2;
+	m->stack[m->depth >> 2] = (m->stack[m->depth >> 2] & ~(3 << shift)) | (code << shift);
+	m->depth++;
+}
+
+// 괄호 한 바이트 처리 - 짝이 안 맞으면 errorOffset을 기록하고 1
+static int matchByte(BracketMatcher *m, int cls, long long at)
+{
+	int top;
+
+	if (cls <= 3) {
+		pushCode(m, cls - 1);
+		return 0;
+	}
+	if (m->depth == 0) {
+		m->errorOffset = at;
+		return 1;
+	}
+	m->depth--;
+	top = (m->stack[m->depth >> 2] >> ((m->depth & 3) * 2)) & 3;
+	if (top != cls - 4) {
+		m->errorOffset = at;
+		return 1;
+	}
+	return 0;
+}
+
+static int scanScalar(BracketMatcher *m, const unsigned char *p, long long len, long long base)
+{
+	long long i;
+	int cls;
+
+	for (i = 0; i < len; i++) {
+		cls = bracketClass[p[i]];
+		if (cls && matchByte(m, cls, base + i))
+			return 1;
+	}
+	return 0;
+}
+
+#ifdef HAVE_X86_SIMD
+
+// 16바이트 블록마다 괄호 위치를 비트마스크로 만들고, 괄호가 없는 블록은 통째로 건너뜀
+__attribute__((target("sse2")))
+static int scanSSE2(BracketMatcher *m, const unsigned char *p, long long len, long long base)
+{
+	const __m128i open1 = _mm_set1_epi8('('), close1 = _mm_set1_epi8(')');
+	const __m128i open2 = _mm_set1_epi8('['), close2 = _mm_set1_epi8(']');
+	const __m128i open3 = _mm_set1_epi8('{'), close3 = _mm_set1_epi8('}');
+	long long i;
+	unsigned mask;
+	int bit;
+	__m128i block, hits;
+
+	for (i = 0; i + 16 <= len; i += 16) {
+		block = _mm_loadu_si128((const __m128i *)(p + i));
+		hits = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(block, open1), _mm_cmpeq_epi8(block, close1)),
+			_mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(block, open2), _mm_cmpeq_epi8(block, close2)),
+				_mm_or_si128(_mm_cmpeq_epi8(block, open3), _mm_cmpeq_epi8(block, close3))));
+		mask = (unsigned)_mm_movemask_epi8(hits);
+		while (mask) {
+			bit = __builtin_ctz(mask);
+			if (matchByte(m, bracketClass[p[i + bit]], base + i + bit))
+				return 1;
+			mask &= mask - 1;
+		}
+	}
+	return scanScalar(m, p + i, len - i, base + i);
+}
+
+__attribute__((target("avx2")))
+static int scanAVX2(BracketMatcher *m, const unsigned char *p, long long len, long long base)
+{
+	const __m256i open1 = _mm256_set1_epi8('('), close1 = _mm256_set1_epi8(')');
+	const __m256i open2 = _mm256_set1_epi8('['), close2 = _mm256_set1_epi8(']');
+	const __m256i open3 = _mm256_set1_epi8('{'), close3 = _mm256_set1_epi8('}');
+	long long i;
+	unsigned mask;
+	int bit;
+	__m256i block, hits;
+
+	for (i = 0; i + 32 <= len; i += 32) {
+		block = _mm256_loadu_si256((const __m256i *)(p + i));
+		hits = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(block, open1), _mm256_cmpeq_epi8(block, close1)),
+			_mm256_or_si256(
+				_mm256_or_si256(_mm256_cmpeq_epi8(block, open2), _mm256_cmpeq_epi8(block, close2)),
+				_mm256_or_si256(_mm256_cmpeq_epi8(block, open3), _mm256_cmpeq_epi8(block, close3))));
+		mask = (unsigned)_mm256_movemask_epi8(hits);
+		while (mask) {
+			bit = __builtin_ctz(mask);
+			if (matchByte(m, bracketClass[p[i + bit]], base + i + bit))
+				return 1;
+			mask &= mask - 1;
+		}
+	}
+	return scanScalar(m, p + i, len - i, base + i);
+}
+
+#endif
+
+// 0 = scalar, 1 = SSE2, 2 = AVX2 - the benchmark pins it to compare the paths
+static int scanLevel = -1;
+
+static int bestScanLevel(void)
+{
+#ifdef HAVE_X86_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return 2;
+	if (__builtin_cpu_supports("sse2"))
+		return 1;
+#endif
+	return 0;
+}
+
+// 다음 조각을 이어서 검사 - 이미 어긋났으면 아무것도 안 함
+// - 지금까지 어긋난 곳이 있으면 1, 없으면 0
+int feedMatcher(BracketMatcher *m, const char *chunk, long long len)
+{
+	const unsigned char *p = (const unsigned char *)chunk;
+	long long base = m->offset;
+
+	if (m->errorOffset != -1)
+		return 1;
+	if (scanLevel == -1)
+		scanLevel = bestScanLevel();
+	m->offset += len;
+#ifdef HAVE_X86_SIMD
+	if (scanLevel == 2)
+		return scanAVX2(m, p, len, base);
+	if (scanLevel == 1)
+		return scanSSE2(m, p, len, base);
+#endif
+	return scanScalar(m, p, len, base);
+}
+
+// 입력 끝 - 닫히지 않은 괄호가 남아 있으면 입력 끝 위치를 어긋난 곳으로 봄
+int finishMatcher(BracketMatcher *m)
+{
+	if (m->errorOffset == -1 && m->depth > 0)
+		m->errorOffset = m->offset;
+	return m->errorOffset != -1;
+}
+
+// Returns 0 if balanced, 1 if not (and sets *errorOffset), -1 if unreadable
+int balancedFile(const char *path, long long *errorOffset)
+{
+	FILE *fp = fopen(path, "rb");
+	BracketMatcher m;
+	char *buffer;
+	size_t n;
+	int result;
+
+	if (fp == NULL)
+		return -1;
+	buffer = malloc(CHUNK_SIZE);
+	if (buffer == NULL) {
+		fclose(fp);
+		return -1;
+	}
+	initMatcher(&m);
+	while ((n = fread(buffer, 1, CHUNK_SIZE, fp)) > 0) {
+		if (feedMatcher(&m, buffer, n))
+			break;
+	}
+	result = finishMatcher(&m);
+	*errorOffset = m.errorOffset;
+	destroyMatcher(&m);
+	free(buffer);
+	fclose(fp);
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// Q7's balanced(): one malloc'd ListNode per opening bracket
+static int listBalanced(const char *expression)
+{
+	ListNode *top = NULL, *node;
+	int result = 0;
+
+	while (*expression) {
+		if (*expression == '(' || *expression == '[' || *expression == '{') {
+			node = malloc(sizeof(ListNode));
+			if (node == NULL)
+				exit(0);
+			node->item = *expression;
+			node->next = top;
+			top = node;
+		}
+		else {
+			if (top == NULL) {
+				result = 1;
+				break;
+			}
+			node = top;
+			top = node->next;
+			if (abs(node->item - *expression) > 2)
+				result = 1;
+			free(node);
+			if (result)
+				break;
+		}
+		expression++;
+	}
+	if (top != NULL)
+		result = 1;
+	while (top != NULL) {
+		node = top;
+		top = node->next;
+		free(node);
+	}
+	return result;
+}
+
+// 깊이가 maxDepth를 넘지 않는 무작위 균형 괄호열을 만들고, noise 비율만큼 괄호 아닌 문자를 섞음
+static void makeExpression(char *buffer, long long len, int noisePercent, int maxDepth)
+{
+	const char *opening = "([{", *closing = ")]}";
+	char *open = malloc(maxDepth);
+	long long i;
+	int depth = 0, k;
+
+	if (open == NULL)
+		exit(0);
+	for (i = 0; i < len; i++) {
+		if (len - i > depth && rand() % 100 < noisePercent) {
+			buffer[i] = 'a' + rand() % 26;
+			continue;
+		}
+		// 남은 길이로 전부 닫을 수 있도록 끝에 가까우면 닫기만 함
+		if (depth > 0 && (depth == maxDepth || len - i <= depth || rand() % 2)) {
+			buffer[i] = closing[(int)open[--depth]];
+		}
+		else {
+			k = rand() % 3;
+			open[depth++] = k;
+			buffer[i] = opening[k];
+		}
+	}
+	buffer[len] = '\0';
+	free(open);
+}
+
+static double timeStreaming(const char *expression, long long len, int level, int *result)
+{
+	BracketMatcher m;
+	clock_t start;
+	long long i, n;
+
+	scanLevel = level;
+	start = clock();
+	initMatcher(&m);
+	for (i = 0; i < len; i += CHUNK_SIZE) {
+		n = len - i < CHUNK_SIZE ? len - i : CHUNK_SIZE;
+		feedMatcher(&m, expression + i, n);
+	}
+	*result = finishMatcher(&m);
+	destroyMatcher(&m);
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void report(const char *name, double seconds, long long len, int result)
+{
+	printf("  %-22s %.3f s (%7.1f MB/s) -> %s\n", name, seconds,
+		seconds > 0 ? len / seconds / 1e6 : 0.0, result ? "not balanced" : "balanced");
+}
+
+// 괄호만 있는 입력(리스트 스택과 비교 가능)과 괄호가 10%인 입력에서 경로별 처리 속도 비교
+void benchmarkBalanced(int megabytes)
+{
+	static const char *names[] = { "streaming scalar", "streaming SSE2", "streaming AVX2" };
+	long long len = (long long)megabytes * 1000000;
+	int noise[2] = { 0, 90 };
+	int best = bestScanLevel();
+	char *expression;
+	clock_t start;
+	double seconds;
+	int t, level, result;
+
+	if (megabytes <= 0)
+		return;
+	expression = malloc(len + 1);
+	if (expression == NULL)
+		return;
+	for (t = 0; t < 2; t++) {
+		makeExpression(expression, len, noise[t], 4096);
+		printf("%d MB, %d%% non-bracket bytes:\n", megabytes, noise[t]);
+		if (noise[t] == 0) {
+			start = clock();
+			result = listBalanced(expression);
+			report("linked list stack", (double)(clock() - start) / CLOCKS_PER_SEC, len, result);
+		}
+		for (level = 0; level <= best; level++) {
+			seconds = timeStreaming(expression, len, level, &result);
+			report(names[level], seconds, len, result);
+		}
+	}
+	scanLevel = best;
+	free(expression);
+}
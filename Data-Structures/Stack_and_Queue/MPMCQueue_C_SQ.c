@@ -0,0 +1,484 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section C - Stack and Queue
+Purpose: Bounded lock-free multi-producer/multi-consumer queue with sequence-numbered
+		 slots, a no-loss/no-duplicate test and a 1-16 thread scaling benchmark
+		 against a mutex-wrapped linked list queue. Build with: gcc -O2 -pthread */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define CACHE_LINE_SIZE 64
+#define MPMC_DEFAULT_CAPACITY 1024	// rounded up to a power of two
+#define MAX_THREADS 16				// per side: up to 16 producers and 16 consumers
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// A slot is free for the producer claiming position pos when sequence == pos,
+// and holds an item for the consumer claiming pos when sequence == pos + 1
+typedef struct _slot
+{
+	atomic_size_t sequence;
+	int item;
+} Slot;
+
+typedef struct _mpmcqueue
+{
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t enqueuePos;	// next position to fill
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t dequeuePos;	// next position to drain
+	_Alignas(CACHE_LINE_SIZE) Slot *slots;
+	size_t mask;
+} MPMCQueue;
+
+typedef struct _listnode
+{
+	int item;
+	struct _listnode *next;
+} ListNode;
+
+typedef struct _lockedqueue
+{
+	pthread_mutex_t lock;
+	int size;
+	ListNode *head;
+	ListNode *tail;
+} LockedQueue;	// mutex-wrapped list queue, only used by the benchmark
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+int initQueue(MPMCQueue *q, size_t capacity);
+void destroyQueue(MPMCQueue *q);
+int enqueue(MPMCQueue *q, int item);
+int tryDequeue(MPMCQueue *q, int *item);
+int dequeue(MPMCQueue *q);
+int isEmptyQueue(MPMCQueue *q);
+void printQueue(MPMCQueue *q);
+
+int correctnessTest(int threads, int perProducer, int capacity);
+void benchmarkScaling(int total, int capacity);
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j, k;
+	MPMCQueue q;
+
+	c = 1;
+
+	// Initialize the Queue as an empty bounded queue
+	if (initQueue(&q, MPMC_DEFAULT_CAPACITY) == -1)
+		return 1;
+
+	printf("1: Insert an integer into the queue:\n");
+	printf("2: Dequeue an integer from the queue:\n");
+	printf("3: Run the multi-thread lost/duplicate item test:\n");
+	printf("4: Run the 1-16 thread scaling benchmark:\n");
+	printf("0: Quit:\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1/2/3/4/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the queue: ");
+			scanf("%d", &i);
+			if (enqueue(&q, i) == -1)
+				printf("The queue is full\n");
+			printf("The resulting queue is: ");
+			printQueue(&q);
+			break;
+		case 2:
+			if (tryDequeue(&q, &i))
+				printf("Dequeued %d\n", i);
+			else
+				printf("The queue is empty\n");
+			printf("The resulting queue is: ");
+			printQueue(&q);
+			break;
+		case 3:
+			printf("Input the threads per side, items per producer and the queue capacity: ");
+			scanf("%d %d %d", &i, &j, &k);
+			if (correctnessTest(i, j, k))
+				printf("Test passed: every item was dequeued exactly once\n");
+			else
+				printf("Test FAILED\n");
+			break;
+		case 4:
+			printf("Input the total number of items and the queue capacity: ");
+			scanf("%d %d", &i, &j);
+			benchmarkScaling(i, j);
+			break;
+		case 0:
+			destroyQueue(&q);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+int initQueue(MPMCQueue *q, size_t capacity)
+{
+	size_t size = 2;
+	size_t i;
+
+	while (size < capacity)
+		size *= 2;
+	q->slots = malloc(sizeof(Slot) * size);
+	if (q->slots == NULL)
+		return -1;
+	for (i = 0; i < size; i++)
+		atomic_init(&q->slots[i].sequence, i);
+	q->mask = size - 1;
+	atomic_init(&q->enqueuePos, 0);
+	atomic_init(&q->dequeuePos, 0);
+	return 0;
+}
+
+void destroyQueue(MPMCQueue *q)
+{
+	free(q->slots);
+	q->slots = NULL;
+}
+
+// 여러 producer가 동시에 호출 가능 - 가득 차 있으면 -1
+// - 슬롯의 sequence가 pos와 같으면 비어 있는 슬롯 -> CAS로 pos를 차지한 뒤 값을 씀
+// - 값을 쓴 뒤 sequence를 pos + 1로 release하면 consumer에게 보임
+int enqueue(MPMCQueue *q, int item)
+{
+	size_t pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+	Slot *slot;
+	size_t seq;
+	long diff;
+
+	for (;;) {
+		slot = &q->slots[pos & q->mask];
+		seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+		diff = (long)seq - (long)pos;
+		if (diff == 0) {
+			// 실패하면 pos가 최신 값으로 바뀌므로 그대로 다시 시도
+			if (atomic_compare_exchange_weak_explicit(&q->enqueuePos, &pos, pos + 1,
+					memory_order_relaxed, memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0) {
+			return -1;	// 한 바퀴 전 항목이 아직 안 빠짐 = 가득 참
+		}
+		else {
+			pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+		}
+	}
+	slot->item = item;
+	atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+	return 0;
+}
+
+// 여러 consumer가 동시에 호출 가능 - 꺼냈으면 1, 비어 있으면 0
+// - 다 읽은 슬롯은 sequence를 pos + capacity로 돌려놓아 다음 바퀴 producer에게 넘김
+int tryDequeue(MPMCQueue *q, int *item)
+{
+	size_t pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+	Slot *slot;
+	size_t seq;
+	long diff;
+
+	for (;;) {
+		slot = &q->slots[pos & q->mask];
+		seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+		diff = (long)seq - (long)(pos + 1);
+		if (diff == 0) {
+			if (atomic_compare_exchange_weak_explicit(&q->dequeuePos, &pos, pos + 1,
+					memory_order_relaxed, memory_order_relaxed))
+				break;
+		}
+		else if (diff < 0) {
+			return 0;	// 아직 아무도 안 채운 슬롯 = 비어 있음
+		}
+		else {
+			pos = atomic_load_explicit(&q->dequeuePos, memory_order_relaxed);
+		}
+	}
+	*item = slot->item;
+	atomic_store_explicit(&slot->sequence, pos + q->mask + 1, memory_order_release);
+	return 1;
+}
+
+// Same semantics as the list-based dequeue(): -1 when the queue is empty
+int dequeue(MPMCQueue *q)
+{
+	int item;
+
+	if (tryDequeue(q, &item))
+		return item;
+	return -1;
+}
+
+// A snapshot: other threads may change the answer right after it is returned
+int isEmptyQueue(MPMCQueue *q)
+{
+	size_t pos = atomic_load_explicit(&q->dequeuePos, memory_order_acquire);
+	Slot *slot = &q->slots[pos & q->mask];
+
+	if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != pos + 1)
+		return 1;
+	return 0;
+}
+
+// Only meaningful while no other thread is using the queue
+void printQueue(MPMCQueue *q)
+{
+	size_t head = atomic_load(&q->dequeuePos);
+	size_t tail = atomic_load(&q->enqueuePos);
+
+	if (head == tail)
+		printf("Empty");
+	for (; head != tail; head++)
+		printf("%d ", q->slots[head & q->mask].item);
+	printf("\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static void lockedEnqueue(LockedQueue *lq, int item)
+{
+	ListNode *node = malloc(sizeof(ListNode));
+
+	if (node == NULL)
+		exit(0);
+	node->item = item;
+	node->next = NULL;
+	pthread_mutex_lock(&lq->lock);
+	if (lq->head == NULL)
+		lq->head = node;
+	else
+		lq->tail->next = node;
+	lq->tail = node;
+	lq->size++;
+	pthread_mutex_unlock(&lq->lock);
+}
+
+static int lockedTryDequeue(LockedQueue *lq, int *item)
+{
+	ListNode *node;
+
+	pthread_mutex_lock(&lq->lock);
+	node = lq->head;
+	if (node == NULL) {
+		pthread_mutex_unlock(&lq->lock);
+		return 0;
+	}
+	lq->head = node->next;
+	if (lq->head == NULL)
+		lq->tail = NULL;
+	lq->size--;
+	pthread_mutex_unlock(&lq->lock);
+
+	*item = node->item;
+	free(node);
+	return 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _workload
+{
+	MPMCQueue *mpmc;		// exactly one of mpmc / locked is set
+	LockedQueue *locked;
+	int producers;
+	int perProducer;		// producer p enqueues p * perProducer .. (p + 1) * perProducer - 1
+	atomic_int consumed;	// consumers stop once every item has been taken
+	atomic_int *seenCount;	// per item, NULL when not checking
+	atomic_int orderOk;		// each consumer sees a producer's items in increasing order
+} Workload;
+
+typedef struct _worker
+{
+	Workload *w;
+	int id;
+} Worker;
+
+static void *producerMain(void *arg)
+{
+	Worker *me = arg;
+	Workload *w = me->w;
+	int first = me->id * w->perProducer;
+	int i;
+
+	for (i = first; i < first + w->perProducer; i++) {
+		if (w->mpmc) {
+			while (enqueue(w->mpmc, i) == -1)
+				sched_yield();
+		}
+		else {
+			lockedEnqueue(w->locked, i);
+		}
+	}
+	return NULL;
+}
+
+static void *consumerMain(void *arg)
+{
+	Worker *me = arg;
+	Workload *w = me->w;
+	int total = w->producers * w->perProducer;
+	int lastFrom[MAX_THREADS];
+	int item, got, p;
+
+	for (p = 0; p < MAX_THREADS; p++)
+		lastFrom[p] = -1;
+	while (atomic_load_explicit(&w->consumed, memory_order_relaxed) < total) {
+		if (w->mpmc)
+			got = tryDequeue(w->mpmc, &item);
+		else
+			got = lockedTryDequeue(w->locked, &item);
+		if (!got) {
+			sched_yield();
+			continue;
+		}
+		atomic_fetch_add_explicit(&w->consumed, 1, memory_order_relaxed);
+		if (w->seenCount == NULL)
+			continue;
+		if (item < 0 || item >= total) {
+			atomic_store(&w->orderOk, 0);
+			continue;
+		}
+		// 누락/중복은 항목별 카운트로, 같은 producer 항목끼리의 순서는 lastFrom으로 검사
+		atomic_fetch_add_explicit(&w->seenCount[item], 1, memory_order_relaxed);
+		p = item / w->perProducer;
+		if (item <= lastFrom[p])
+			atomic_store(&w->orderOk, 0);
+		lastFrom[p] = item;
+	}
+	return NULL;
+}
+
+// threads개 producer + threads개 consumer를 띄우고 모두 끝날 때까지 기다림
+static void runWorkload(Workload *w, int threads)
+{
+	pthread_t producers[MAX_THREADS], consumers[MAX_THREADS];
+	Worker workers[MAX_THREADS];
+	int i;
+
+	w->producers = threads;
+	atomic_init(&w->consumed, 0);
+	atomic_init(&w->orderOk, 1);
+	for (i = 0; i < threads; i++) {
+		workers[i].w = w;
+		workers[i].id = i;
+	}
+	for (i = 0; i < threads; i++) {
+		if (pthread_create(&consumers[i], NULL, consumerMain, &workers[i]) != 0)
+			exit(0);
+	}
+	for (i = 0; i < threads; i++) {
+		if (pthread_create(&producers[i], NULL, producerMain, &workers[i]) != 0)
+			exit(0);
+	}
+	for (i = 0; i < threads; i++)
+		pthread_join(producers[i], NULL);
+	for (i = 0; i < threads; i++)
+		pthread_join(consumers[i], NULL);
+}
+
+// 모든 항목이 정확히 한 번씩 나왔는지, 큐가 비었는지 확인
+int correctnessTest(int threads, int perProducer, int capacity)
+{
+	MPMCQueue q;
+	Workload w = {0};
+	int total, i, ok;
+
+	if (threads <= 0 || threads > MAX_THREADS || perProducer <= 0 || capacity <= 0)
+		return 0;
+	if (perProducer > 0x7fffffff / threads)
+		return 0;
+	total = threads * perProducer;
+	if (initQueue(&q, capacity) == -1)
+		return 0;
+	w.seenCount = calloc(total, sizeof(atomic_int));
+	if (w.seenCount == NULL) {
+		destroyQueue(&q);
+		return 0;
+	}
+	w.mpmc = &q;
+	w.perProducer = perProducer;
+	runWorkload(&w, threads);
+
+	ok = atomic_load(&w.orderOk) && isEmptyQueue(&q);
+	for (i = 0; i < total; i++) {
+		if (atomic_load(&w.seenCount[i]) != 1)
+			ok = 0;
+	}
+	free(w.seenCount);
+	destroyQueue(&q);
+	return ok;
+}
+
+static double nowSeconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 1, 2, 4, 8, 16개씩 producer/consumer를 띄워 total개 항목을 전달하는 시간 비교
+void benchmarkScaling(int total, int capacity)
+{
+	MPMCQueue q;
+	LockedQueue lq;
+	Workload w = {0};
+	double start, lockedTime, mpmcTime;
+	int threads;
+
+	if (total <= 0 || capacity <= 0)
+		return;
+	printf("threads/side   mutex list (M ops/s)   MPMC ring (M ops/s)\n");
+	for (threads = 1; threads <= MAX_THREADS; threads *= 2) {
+		w.perProducer = total / threads;
+		if (w.perProducer == 0)
+			break;
+
+		pthread_mutex_init(&lq.lock, NULL);
+		lq.head = NULL;
+		lq.tail = NULL;
+		lq.size = 0;
+		w.mpmc = NULL;
+		w.locked = &lq;
+		start = nowSeconds();
+		runWorkload(&w, threads);
+		lockedTime = nowSeconds() - start;
+		pthread_mutex_destroy(&lq.lock);
+
+		if (initQueue(&q, capacity) == -1)
+			return;
+		w.locked = NULL;
+		w.mpmc = &q;
+		start = nowSeconds();
+		runWorkload(&w, threads);
+		mpmcTime = nowSeconds() - start;
+		destroyQueue(&q);
+
+		// enqueue + dequeue 각각을 한 op로 셈
+		printf("%12d   %20.2f   %19.2f\n", threads,
+			lockedTime > 0 ? 2.0 * threads * w.perProducer / lockedTime / 1e6 : 0.0,
+			mpmcTime > 0 ? 2.0 * threads * w.perProducer / mpmcTime / 1e6 : 0.0);
+	}
+}
@@ -53,6 +53,7 @@ int isEmptyQueue(Queue *s);
 void printList(LinkedList *ll);
 ListNode * findNode(LinkedList *ll, int index);
 int insertNode(LinkedList *ll, int index, int value);
+int appendNode(LinkedList *ll, int value);
 int removeNode(LinkedList *ll, int index);
 void removeAllItems(LinkedList *ll);
 
@@ -117,6 +118,7 @@ void reverse(Queue *q)
 
 	Stack s;
 	s.ll.head = NULL;
+	s.ll.tail = NULL;
 	s.ll.size = 0;
 
 	while (q->ll.size > 0)
@@ -153,7 +155,7 @@ int isEmptyStack(Stack *s){
 }
 
 void enqueue(Queue *q, int item){
-   insertNode(&(q->ll), q->ll.size, item);
+   appendNode(&(q->ll), item);
 }
 
 int dequeue(Queue *q){
@@ -217,12 +219,18 @@ int insertNode(LinkedList *ll, int index, int value){
 	if (ll == NULL || index < 0 || index > ll->size + 1)
 		return -1;
 
+	// Appending after the last node never needs to walk the list
+	if (index == ll->size)
+		return appendNode(ll, value);
+
 	// If empty list or inserting first node, need to update head pointer
 	if (ll->head == NULL || index == 0){
 		cur = ll->head;
 		ll->head = malloc(sizeof(ListNode));
 		ll->head->item = value;
 		ll->head->next = cur;
+		if (ll->tail == NULL)
+			ll->tail = ll->head;
 		ll->size++;
 		return 0;
 	}
@@ -235,6 +243,8 @@ int insertNode(LinkedList *ll, int index, int value){
 		pre->next = malloc(sizeof(ListNode));
 		pre->next->item = value;
 		pre->next->next = cur;
+		if (cur == NULL)
+			ll->tail = pre->next;
 		ll->size++;
 		return 0;
 	}
@@ -243,6 +253,28 @@ int insertNode(LinkedList *ll, int index, int value){
 }
 
 
+int appendNode(LinkedList *ll, int value){
+
+	ListNode *newNode;
+
+	if (ll == NULL)
+		return -1;
+
+	// Link the new node straight after the tail pointer
+	newNode = malloc(sizeof(ListNode));
+	newNode->item = value;
+	newNode->next = NULL;
+
+	if (ll->head == NULL)
+		ll->head = newNode;
+	else
+		ll->tail->next = newNode;
+	ll->tail = newNode;
+	ll->size++;
+	return 0;
+}
+
+
 int removeNode(LinkedList *ll, int index){
 
 	ListNode *pre, *cur;
@@ -256,6 +288,8 @@ int removeNode(LinkedList *ll, int index){
 		cur = ll->head->next;
 		free(ll->head);
 		ll->head = cur;
+		if (cur == NULL)
+			ll->tail = NULL;
 		ll->size--;
 
 		return 0;
@@ -270,6 +304,8 @@ int removeNode(LinkedList *ll, int index){
 
 		cur = pre->next;
 		pre->next = cur->next;
+		if (cur == ll->tail)
+			ll->tail = pre;
 		free(cur);
 		ll->size--;
 		return 0;
@@ -289,5 +325,6 @@ void removeAllItems(LinkedList *ll)
 		cur = tmp;
 	}
 	ll->head = NULL;
+	ll->tail = NULL;
 	ll->size = 0;
 }
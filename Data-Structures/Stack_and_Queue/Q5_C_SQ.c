@@ -21,7 +21,8 @@ typedef struct _linkedlist
 {
 	int size;
 	ListNode *head;
-} LinkedList;	// You should not change the definition of LinkedList
+	ListNode *tail;
+} LinkedList;
 
 
 typedef struct _queue
@@ -44,6 +45,7 @@ void printList(LinkedList *ll);
 void removeAllItems(LinkedList *ll);
 ListNode * findNode(LinkedList *ll, int index);
 int insertNode(LinkedList *ll, int index, int value);
+int appendNode(LinkedList *ll, int value);
 int removeNode(LinkedList *ll, int index);
 
 //////////////////////////// main() //////////////////////////////////////////////
@@ -58,10 +60,12 @@ int main()
 
 	// Initialize the linked list as an empty linked list
 	ll.head = NULL;
+	ll.tail = NULL;
 	ll.size = 0;
 
 	// Initialize the Queue as an empty queue
 	q.ll.head = NULL;
+	q.ll.tail = NULL;
 	q.ll.size = 0;
 
 
@@ -141,13 +145,14 @@ void removeAllItems(LinkedList *ll)
 		cur = tmp;
 	}
 	ll->head = NULL;
+	ll->tail = NULL;
 	ll->size = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void enqueue(Queue *q, int item) {
-	insertNode(&(q->ll), q->ll.size, item);
+	appendNode(&(q->ll), item);
 }
 
 int dequeue(Queue *q) {
@@ -212,6 +217,10 @@ int insertNode(LinkedList *ll, int index, int value){
 	if (ll == NULL || index < 0 || index > ll->size + 1)
 		return -1;
 
+	// Appending after the last node never needs to walk the list
+	if (index == ll->size)
+		return appendNode(ll, value);
+
 	// If empty list or inserting first node, need to update head pointer
 	if (ll->head == NULL || index == 0){
 		cur = ll->head;
@@ -222,6 +231,8 @@ int insertNode(LinkedList *ll, int index, int value){
 		}
 		ll->head->item = value;
 		ll->head->next = cur;
+		if (ll->tail == NULL)
+			ll->tail = ll->head;
 		ll->size++;
 		return 0;
 	}
@@ -238,6 +249,8 @@ int insertNode(LinkedList *ll, int index, int value){
 		}
 		pre->next->item = value;
 		pre->next->next = cur;
+		if (cur == NULL)
+			ll->tail = pre->next;
 		ll->size++;
 		return 0;
 	}
@@ -246,6 +259,32 @@ int insertNode(LinkedList *ll, int index, int value){
 }
 
 
+int appendNode(LinkedList *ll, int value){
+
+	ListNode *newNode;
+
+	if (ll == NULL)
+		return -1;
+
+	// Link the new node straight after the tail pointer
+	newNode = malloc(sizeof(ListNode));
+	if (newNode == NULL)
+	{
+		exit(0);
+	}
+	newNode->item = value;
+	newNode->next = NULL;
+
+	if (ll->head == NULL)
+		ll->head = newNode;
+	else
+		ll->tail->next = newNode;
+	ll->tail = newNode;
+	ll->size++;
+	return 0;
+}
+
+
 int removeNode(LinkedList *ll, int index){
 
 	ListNode *pre, *cur;
@@ -259,6 +298,8 @@ int removeNode(LinkedList *ll, int index){
 		cur = ll->head->next;
 		free(ll->head);
 		ll->head = cur;
+		if (cur == NULL)
+			ll->tail = NULL;
 		ll->size--;
 		return 0;
 	}
@@ -272,6 +313,8 @@ int removeNode(LinkedList *ll, int index){
 
 		cur = pre->next;
 		pre->next = cur->next;
+		if (cur == ll->tail)
+			ll->tail = pre;
 		free(cur);
 		ll->size--;
 		return 0;
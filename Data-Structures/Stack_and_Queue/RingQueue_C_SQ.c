@@ -0,0 +1,326 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section C - Stack and Queue
+Purpose: Growable power-of-two ring-buffer Queue behind the enqueue/dequeue API,
+		 with in-place reverse() / recursiveReverse() and a throughput benchmark */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define QUEUE_INITIAL_CAPACITY 16	// must be a power of two
+
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _queue
+{
+	int *items;
+	int head;		// index of the front item
+	int size;
+	int capacity;	// always a power of two, so (i & (capacity - 1)) wraps
+} Queue;
+
+typedef struct _listnode
+{
+	int item;
+	struct _listnode *next;
+} ListNode;
+
+typedef struct _linkedlist
+{
+	int size;
+	ListNode *head;
+	ListNode *tail;
+} LinkedList;	// list-backed queue, only used by the benchmark
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+void reverse(Queue *q);
+void recursiveReverse(Queue *q);
+
+void initQueue(Queue *q);
+void enqueue(Queue *q, int item);
+int dequeue(Queue *q);
+int isEmptyQueue(Queue *q);
+void removeAllItemsFromQueue(Queue *q);
+void destroyQueue(Queue *q);
+void printQueue(Queue *q);
+
+void benchmarkQueue(int n, int rounds);
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j;
+	Queue q;
+
+	c = 1;
+
+	// Initialize the Queue as an empty queue
+	initQueue(&q);
+
+	printf("1: Insert an integer into the queue:\n");
+	printf("2: Dequeue an integer from the queue:\n");
+	printf("3: Reverse the queue:\n");
+	printf("4: Recursively reverse the queue:\n");
+	printf("5: Run the ring buffer vs linked list queue benchmark:\n");
+	printf("0: Quit:\n");
+
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1/2/3/4/5/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the queue: ");
+			scanf("%d", &i);
+			enqueue(&q, i);
+			printf("The resulting queue is: ");
+			printQueue(&q);
+			break;
+		case 2:
+			if (isEmptyQueue(&q))
+				printf("The queue is empty\n");
+			else
+				printf("Dequeued %d\n", dequeue(&q));
+			printf("The resulting queue is: ");
+			printQueue(&q);
+			break;
+		case 3:
+			reverse(&q);
+			printf("The resulting queue after reversing its elements is: ");
+			printQueue(&q);
+			break;
+		case 4:
+			recursiveReverse(&q);
+			printf("The resulting reversed queue is: ");
+			printQueue(&q);
+			break;
+		case 5:
+			printf("Input the queue size and the number of rounds: ");
+			scanf("%d %d", &i, &j);
+			benchmarkQueue(i, j);
+			break;
+		case 0:
+			destroyQueue(&q);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+
+	}
+
+	return 0;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// 앞뒤 원소를 맞바꾸며 제자리에서 뒤집음 (추가 메모리 없음)
+void reverse(Queue *q)
+{
+	int mask = q->capacity - 1;
+	int i, j, tmp;
+
+	for (i = 0, j = q->size - 1; i < j; i++, j--) {
+		tmp = q->items[(q->head + i) & mask];
+		q->items[(q->head + i) & mask] = q->items[(q->head + j) & mask];
+		q->items[(q->head + j) & mask] = tmp;
+	}
+}
+
+// front에서 i번째와 j번째를 바꾸고 안쪽 구간을 재귀로 뒤집음
+static void reverseRange(Queue *q, int i, int j)
+{
+	int mask = q->capacity - 1;
+	int tmp;
+
+	if (i >= j)
+		return;
+	tmp = q->items[(q->head + i) & mask];
+	q->items[(q->head + i) & mask] = q->items[(q->head + j) & mask];
+	q->items[(q->head + j) & mask] = tmp;
+	reverseRange(q, i + 1, j - 1);
+}
+
+void recursiveReverse(Queue *q)
+{
+	reverseRange(q, 0, q->size - 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+void initQueue(Queue *q)
+{
+	q->items = NULL;
+	q->head = 0;
+	q->size = 0;
+	q->capacity = 0;
+}
+
+// 가득 차면 두 배 크기 버퍼로 옮기면서 front가 0번에 오도록 펼침
+static void growQueue(Queue *q)
+{
+	int newCapacity = q->capacity ? q->capacity * 2 : QUEUE_INITIAL_CAPACITY;
+	int *newItems = malloc(sizeof(int) * newCapacity);
+	int i;
+
+	if (newItems == NULL)
+		exit(0);
+	for (i = 0; i < q->size; i++)
+		newItems[i] = q->items[(q->head + i) & (q->capacity - 1)];
+	free(q->items);
+	q->items = newItems;
+	q->head = 0;
+	q->capacity = newCapacity;
+}
+
+void enqueue(Queue *q, int item)
+{
+	if (q->size == q->capacity)
+		growQueue(q);
+	q->items[(q->head + q->size) & (q->capacity - 1)] = item;
+	q->size++;
+}
+
+int dequeue(Queue *q)
+{
+	int item;
+
+	if (!isEmptyQueue(q)) {
+		item = q->items[q->head];
+		q->head = (q->head + 1) & (q->capacity - 1);
+		q->size--;
+		return item;
+	}
+	return -1;
+}
+
+int isEmptyQueue(Queue *q)
+{
+	if (q->size == 0)
+		return 1;
+	return 0;
+}
+
+// Emptying keeps the buffer so the next fill does not allocate again
+void removeAllItemsFromQueue(Queue *q)
+{
+	if (q == NULL)
+		return;
+	q->head = 0;
+	q->size = 0;
+}
+
+void destroyQueue(Queue *q)
+{
+	free(q->items);
+	initQueue(q);
+}
+
+void printQueue(Queue *q)
+{
+	int i;
+
+	if (q->size == 0)
+		printf("Empty");
+	for (i = 0; i < q->size; i++)
+		printf("%d ", q->items[(q->head + i) & (q->capacity - 1)]);
+	printf("\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static void listEnqueue(LinkedList *ll, int item)
+{
+	ListNode *node = malloc(sizeof(ListNode));
+
+	if (node == NULL)
+		exit(0);
+	node->item = item;
+	node->next = NULL;
+	if (ll->head == NULL)
+		ll->head = node;
+	else
+		ll->tail->next = node;
+	ll->tail = node;
+	ll->size++;
+}
+
+static int listDequeue(LinkedList *ll)
+{
+	ListNode *node = ll->head;
+	int item;
+
+	if (node == NULL)
+		return -1;
+	item = node->item;
+	ll->head = node->next;
+	if (ll->head == NULL)
+		ll->tail = NULL;
+	free(node);
+	ll->size--;
+	return item;
+}
+
+// 같은 작업을 tail 포인터가 있는 연결 리스트 큐와 링 버퍼 큐에 돌려 비교
+// - n개 채우기 -> n번 dequeue/enqueue 교대 -> 전부 비우기 를 rounds번 반복
+void benchmarkQueue(int n, int rounds)
+{
+	LinkedList ll;
+	Queue q;
+	clock_t start;
+	double listTime, ringTime;
+	long long ops, listSum = 0, ringSum = 0;
+	int r, i;
+
+	if (n <= 0 || rounds <= 0)
+		return;
+	ops = (long long)rounds * n * 4;
+
+	ll.head = NULL;
+	ll.tail = NULL;
+	ll.size = 0;
+	start = clock();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < n; i++)
+			listEnqueue(&ll, i);
+		for (i = 0; i < n; i++) {
+			listSum += listDequeue(&ll);
+			listEnqueue(&ll, i);
+		}
+		while (ll.size > 0)
+			listSum += listDequeue(&ll);
+	}
+	listTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	initQueue(&q);
+	start = clock();
+	for (r = 0; r < rounds; r++) {
+		for (i = 0; i < n; i++)
+			enqueue(&q, i);
+		for (i = 0; i < n; i++) {
+			ringSum += dequeue(&q);
+			enqueue(&q, i);
+		}
+		while (!isEmptyQueue(&q))
+			ringSum += dequeue(&q);
+	}
+	ringTime = (double)(clock() - start) / CLOCKS_PER_SEC;
+	destroyQueue(&q);
+
+	if (listSum != ringSum)
+		printf("checksum mismatch!\n");
+	printf("linked list queue: %.3f s (%.1f M ops/s)\n", listTime,
+		listTime > 0 ? ops / listTime / 1e6 : 0.0);
+	printf("ring buffer queue: %.3f s (%.1f M ops/s)\n", ringTime,
+		ringTime > 0 ? ops / ringTime / 1e6 : 0.0);
+}
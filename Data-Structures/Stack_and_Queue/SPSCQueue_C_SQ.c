@@ -0,0 +1,417 @@
+//////////////////////////////////////////////////////////////////////////////////
+
+/* CE1007/CZ1007 Data Structures
+Extension: Section C - Stack and Queue
+Purpose: Bounded lock-free single-producer/single-consumer ring queue (C11 atomics),
+		 with a two-thread stress test and a benchmark against a mutex-wrapped
+		 linked list queue. Build with: gcc -O2 -pthread SPSCQueue_C_SQ.c */
+
+//////////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define CACHE_LINE_SIZE 64
+#define SPSC_DEFAULT_CAPACITY 1024	// rounded up to a power of two
+
+//////////////////////////////////////////////////////////////////////////////////
+
+// head and tail sit on their own cache lines so the producer and the consumer
+// never write to the same line; each side also caches the other's index
+typedef struct _spscqueue
+{
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t head;	// written by the consumer only
+	size_t cachedTail;								// consumer's last view of tail
+	_Alignas(CACHE_LINE_SIZE) atomic_size_t tail;	// written by the producer only
+	size_t cachedHead;								// producer's last view of head
+	_Alignas(CACHE_LINE_SIZE) int *items;
+	size_t mask;
+} SPSCQueue;
+
+typedef struct _listnode
+{
+	int item;
+	struct _listnode *next;
+} ListNode;
+
+typedef struct _lockedqueue
+{
+	pthread_mutex_t lock;
+	int size;
+	ListNode *head;
+	ListNode *tail;
+} LockedQueue;	// today's mutex-wrapped list queue, only used by the benchmark
+
+///////////////////////// function prototypes ////////////////////////////////////
+
+int initQueue(SPSCQueue *q, size_t capacity);
+void destroyQueue(SPSCQueue *q);
+int enqueue(SPSCQueue *q, int item);
+int tryDequeue(SPSCQueue *q, int *item);
+int dequeue(SPSCQueue *q);
+int isEmptyQueue(SPSCQueue *q);
+void printQueue(SPSCQueue *q);
+
+int stressTest(int n, int capacity);
+void benchmarkQueue(int n, int capacity);
+
+//////////////////////////// main() //////////////////////////////////////////////
+
+int main()
+{
+	int c, i, j;
+	SPSCQueue q;
+
+	c = 1;
+
+	// Initialize the Queue as an empty bounded queue
+	if (initQueue(&q, SPSC_DEFAULT_CAPACITY) == -1)
+		return 1;
+
+	printf("1: Insert an integer into the queue:\n");
+	printf("2: Dequeue an integer from the queue:\n");
+	printf("3: Run the two-thread stress test:\n");
+	printf("4: Run the SPSC vs mutex list queue benchmark:\n");
+	printf("0: Quit:\n");
+
+	while (c != 0)
+	{
+		printf("Please input your choice(1/2/3/4/0): ");
+		scanf("%d", &c);
+
+		switch (c)
+		{
+		case 1:
+			printf("Input an integer that you want to insert into the queue: ");
+			scanf("%d", &i);
+			if (enqueue(&q, i) == -1)
+				printf("The queue is full\n");
+			printf("The resulting queue is: ");
+			printQueue(&q);
+			break;
+		case 2:
+			if (tryDequeue(&q, &i))
+				printf("Dequeued %d\n", i);
+			else
+				printf("The queue is empty\n");
+			printf("The resulting queue is: ");
+			printQueue(&q);
+			break;
+		case 3:
+			printf("Input the number of items and the queue capacity: ");
+			scanf("%d %d", &i, &j);
+			if (stressTest(i, j))
+				printf("Stress test passed: %d items arrived once and in order\n", i);
+			else
+				printf("Stress test FAILED\n");
+			break;
+		case 4:
+			printf("Input the number of items and the queue capacity: ");
+			scanf("%d %d", &i, &j);
+			benchmarkQueue(i, j);
+			break;
+		case 0:
+			destroyQueue(&q);
+			break;
+		default:
+			printf("Choice unknown;\n");
+			break;
+		}
+	}
+
+	return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+int initQueue(SPSCQueue *q, size_t capacity)
+{
+	size_t size = 2;
+
+	while (size < capacity)
+		size *= 2;
+	q->items = malloc(sizeof(int) * size);
+	if (q->items == NULL)
+		return -1;
+	q->mask = size - 1;
+	atomic_init(&q->head, 0);
+	atomic_init(&q->tail, 0);
+	q->cachedHead = 0;
+	q->cachedTail = 0;
+	return 0;
+}
+
+void destroyQueue(SPSCQueue *q)
+{
+	free(q->items);
+	q->items = NULL;
+}
+
+// producer 쪽에서만 호출
+// - 슬롯에 값을 쓴 뒤 tail을 release로 올려서, consumer가 tail을 acquire로 읽으면 값도 보이게 함
+// - 가득 차 있으면 -1 (bounded queue)
+int enqueue(SPSCQueue *q, int item)
+{
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+	if (tail - q->cachedHead > q->mask) {
+		// 캐시된 head로는 가득 차 보일 때만 진짜 head를 다시 읽음
+		q->cachedHead = atomic_load_explicit(&q->head, memory_order_acquire);
+		if (tail - q->cachedHead > q->mask)
+			return -1;
+	}
+	q->items[tail & q->mask] = item;
+	atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+	return 0;
+}
+
+// consumer 쪽에서만 호출 - 꺼냈으면 1, 비어 있으면 0
+int tryDequeue(SPSCQueue *q, int *item)
+{
+	size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+	if (head == q->cachedTail) {
+		q->cachedTail = atomic_load_explicit(&q->tail, memory_order_acquire);
+		if (head == q->cachedTail)
+			return 0;
+	}
+	*item = q->items[head & q->mask];
+	// 값을 다 읽은 뒤 head를 release로 올려야 producer가 이 슬롯을 덮어써도 안전
+	atomic_store_explicit(&q->head, head + 1, memory_order_release);
+	return 1;
+}
+
+// Same semantics as the list-based dequeue(): -1 when the queue is empty
+int dequeue(SPSCQueue *q)
+{
+	int item;
+
+	if (tryDequeue(q, &item))
+		return item;
+	return -1;
+}
+
+int isEmptyQueue(SPSCQueue *q)
+{
+	if (atomic_load_explicit(&q->head, memory_order_acquire) ==
+		atomic_load_explicit(&q->tail, memory_order_acquire))
+		return 1;
+	return 0;
+}
+
+// Only meaningful while no other thread is using the queue
+void printQueue(SPSCQueue *q)
+{
+	size_t head = atomic_load(&q->head);
+	size_t tail = atomic_load(&q->tail);
+
+	if (head == tail)
+		printf("Empty");
+	for (; head != tail; head++)
+		printf("%d ", q->items[head & q->mask]);
+	printf("\n");
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static void lockedEnqueue(LockedQueue *lq, int item)
+{
+	ListNode *node = malloc(sizeof(ListNode));
+
+	if (node == NULL)
+		exit(0);
+	node->item = item;
+	node->next = NULL;
+	pthread_mutex_lock(&lq->lock);
+	if (lq->head == NULL)
+		lq->head = node;
+	else
+		lq->tail->next = node;
+	lq->tail = node;
+	lq->size++;
+	pthread_mutex_unlock(&lq->lock);
+}
+
+static int lockedTryDequeue(LockedQueue *lq, int *item)
+{
+	ListNode *node;
+
+	pthread_mutex_lock(&lq->lock);
+	node = lq->head;
+	if (node == NULL) {
+		pthread_mutex_unlock(&lq->lock);
+		return 0;
+	}
+	lq->head = node->next;
+	if (lq->head == NULL)
+		lq->tail = NULL;
+	lq->size--;
+	pthread_mutex_unlock(&lq->lock);
+
+	*item = node->item;
+	free(node);
+	return 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+
+static long long nowNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+typedef struct _workload
+{
+	SPSCQueue *spsc;		// exactly one of spsc / locked is set
+	LockedQueue *locked;
+	int n;
+	long long *sentAt;		// enqueue timestamp per item, NULL in the stress test
+	long long *latency;		// dequeue - enqueue time per item
+	int ok;
+} Workload;
+
+static void *producerMain(void *arg)
+{
+	Workload *w = arg;
+	int i;
+
+	for (i = 0; i < w->n; i++) {
+		if (w->sentAt)
+			w->sentAt[i] = nowNs();
+		if (w->spsc) {
+			// 가득 차면 consumer에게 CPU를 넘김 (코어가 하나뿐이면 계속 돌아봐야 소용없음)
+			while (enqueue(w->spsc, i) == -1)
+				sched_yield();
+		}
+		else {
+			lockedEnqueue(w->locked, i);
+		}
+	}
+	return NULL;
+}
+
+static void *consumerMain(void *arg)
+{
+	Workload *w = arg;
+	int expected = 0;
+	int item, got;
+
+	w->ok = 1;
+	while (expected < w->n) {
+		if (w->spsc)
+			got = tryDequeue(w->spsc, &item);
+		else
+			got = lockedTryDequeue(w->locked, &item);
+		if (!got) {
+			sched_yield();
+			continue;
+		}
+		// FIFO 한 쌍이면 0, 1, 2, ... 순서 그대로 정확히 한 번씩 도착해야 함
+		if (item != expected)
+			w->ok = 0;
+		if (w->latency && item >= 0 && item < w->n)
+			w->latency[item] = nowNs() - w->sentAt[item];
+		expected++;
+	}
+	return NULL;
+}
+
+static int runWorkload(Workload *w)
+{
+	pthread_t producer, consumer;
+
+	if (pthread_create(&consumer, NULL, consumerMain, w) != 0)
+		return -1;
+	if (pthread_create(&producer, NULL, producerMain, w) != 0) {
+		pthread_cancel(consumer);
+		return -1;
+	}
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+	return 0;
+}
+
+// producer 스레드가 0..n-1을 넣고 consumer 스레드가 순서/누락/중복을 검사
+int stressTest(int n, int capacity)
+{
+	SPSCQueue q;
+	Workload w = {0};
+
+	if (n <= 0 || capacity <= 0 || initQueue(&q, capacity) == -1)
+		return 0;
+	w.spsc = &q;
+	w.n = n;
+	if (runWorkload(&w) == -1)
+		w.ok = 0;
+	if (!isEmptyQueue(&q))
+		w.ok = 0;
+	destroyQueue(&q);
+	return w.ok;
+}
+
+static int compareLongLong(const void *a, const void *b)
+{
+	long long x = *(const long long *)a;
+	long long y = *(const long long *)b;
+	return (x > y) - (x < y);
+}
+
+static void report(const char *name, Workload *w, double seconds)
+{
+	qsort(w->latency, w->n, sizeof(long long), compareLongLong);
+	printf("%s: %.3f s, %.2f M ops/s, p50 %lld ns, p99 %lld ns%s\n", name, seconds,
+		seconds > 0 ? w->n / seconds / 1e6 : 0.0,
+		w->latency[w->n / 2], w->latency[(int)(w->n * 0.99)],
+		w->ok ? "" : " (ORDER CHECK FAILED)");
+}
+
+// 같은 n개 전달을 mutex 리스트 큐와 SPSC 큐로 각각 돌려 처리량과 지연 분포 비교
+void benchmarkQueue(int n, int capacity)
+{
+	SPSCQueue q;
+	LockedQueue lq;
+	Workload w = {0};
+	long long start;
+
+	if (n <= 0 || capacity <= 0)
+		return;
+	w.n = n;
+	w.sentAt = malloc(sizeof(long long) * n);
+	w.latency = malloc(sizeof(long long) * n);
+	if (w.sentAt == NULL || w.latency == NULL) {
+		free(w.sentAt);
+		free(w.latency);
+		return;
+	}
+
+	pthread_mutex_init(&lq.lock, NULL);
+	lq.head = NULL;
+	lq.tail = NULL;
+	lq.size = 0;
+	w.locked = &lq;
+	start = nowNs();
+	runWorkload(&w);
+	report("mutex list queue", &w, (nowNs() - start) / 1e9);
+	pthread_mutex_destroy(&lq.lock);
+
+	if (initQueue(&q, capacity) == 0) {
+		w.locked = NULL;
+		w.spsc = &q;
+		start = nowNs();
+		runWorkload(&w);
+		report("SPSC ring queue ", &w, (nowNs() - start) / 1e9);
+		destroyQueue(&q);
+	}
+
+	free(w.sentAt);
+	free(w.latency);
+}
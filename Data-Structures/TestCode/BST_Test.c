@@ -184,12 +184,21 @@ BSTNode* createBSTNode(int item) {
 }
 
 void removeAll(BSTNode **node) {
-    if (*node != NULL) {
-        removeAll(&((*node)->left));
-        removeAll(&((*node)->right));
-        free(*node);
-        *node = NULL;
+    BSTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
     }
+    *node = NULL;
 }
 
 BSTNode* createSampleBST1() {
@@ -611,6 +620,42 @@ void test_removeNodeFromTree() {
     }
 }
 
+void test_removeAll() {
+    printf("\n=== Testing Helper: removeAll ===\n");
+    BSTNode *tree, *node;
+    int i;
+
+    // Test 1: Full tree
+    tree = createSampleBST1();
+    removeAll(&tree);
+    TEST_ASSERT_INT_EQ(tree == NULL, 1, "Test 1: Full BST is released and set to NULL");
+
+    // Test 2: Left chain deep enough to overflow a recursive removeAll
+    tree = NULL;
+    for (i = 0; i < 300000; i++) {
+        node = createBSTNode(300000 - i);
+        node->left = tree;
+        tree = node;
+    }
+    removeAll(&tree);
+    TEST_ASSERT_INT_EQ(tree == NULL, 1, "Test 2: 300000-node left chain is released");
+
+    // Test 3: Right chain of the same depth
+    tree = NULL;
+    for (i = 0; i < 300000; i++) {
+        node = createBSTNode(i);
+        node->right = tree;
+        tree = node;
+    }
+    removeAll(&tree);
+    TEST_ASSERT_INT_EQ(tree == NULL, 1, "Test 3: 300000-node right chain is released");
+
+    // Test 4: Empty tree
+    tree = NULL;
+    removeAll(&tree);
+    TEST_ASSERT_INT_EQ(tree == NULL, 1, "Test 4: Empty tree stays NULL");
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // Test Summary
 //////////////////////////////////////////////////////////////////////////////////
@@ -661,6 +706,7 @@ int main() {
     RUN_SAFE_TEST(test_postOrderIterativeS1);
     RUN_SAFE_TEST(test_postOrderIterativeS2);
     RUN_SAFE_TEST(test_removeNodeFromTree);
+    RUN_SAFE_TEST(test_removeAll);
     
     print_test_summary();
     
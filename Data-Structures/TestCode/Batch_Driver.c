@@ -0,0 +1,782 @@
+//////////////////////////////////////////////////////////////////////////////////
+/* Batch Driver - replays Linked List / Stack & Queue / BST operations from a
+   script or a binary int stream, without the interactive menus */
+//////////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LINE_SIZE 4096
+#define IO_BUFFER_SIZE (1 << 20)
+#define BINARY_BLOCK 4096
+
+//////////////////////////////////////////////////////////////////////////////////
+// Data Structure Definitions
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _listnode {
+    int item;
+    struct _listnode *next;
+} ListNode;
+
+typedef struct _linkedlist {
+    int size;
+    ListNode *head;
+    ListNode *tail;
+} LinkedList;
+
+typedef struct _queue {
+    LinkedList ll;
+} Queue;
+
+typedef struct _stack {
+    LinkedList ll;
+} Stack;
+
+typedef struct _bstnode {
+    int item;
+    struct _bstnode *left;
+    struct _bstnode *right;
+} BSTNode;
+
+// Growable array of tree pointers shared by the traversals, so a traversal
+// costs one allocation instead of one QueueNode/StackNode per tree node
+typedef struct _nodestack {
+    BSTNode **items;
+    int size;
+    int capacity;
+} NodeStack;
+
+//////////////////////////////////////////////////////////////////////////////////
+// Operations
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef enum {
+    OP_INSERT, OP_REMOVE, OP_INSERT_SORTED, OP_REVERSE, OP_PRINT_LIST, OP_CLEAR_LIST,
+    OP_ENQUEUE, OP_DEQUEUE, OP_REVERSE_QUEUE, OP_PRINT_QUEUE,
+    OP_PUSH, OP_POP, OP_PRINT_STACK,
+    OP_BST_INSERT, OP_BST_REMOVE, OP_LEVEL_ORDER, OP_IN_ORDER, OP_PRE_ORDER,
+    OP_POST_ORDER_S1, OP_POST_ORDER_S2, OP_CLEAR_BST,
+    OP_COUNT
+} OpCode;
+
+// Script keywords are the function names; in binary mode the opcode is the index
+static const struct {
+    const char *name;
+    int argc;
+} opTable[OP_COUNT] = {
+    { "insertNode", 2 },            // index value
+    { "removeNode", 1 },            // index
+    { "insertSortedLL", 1 },        // value
+    { "RecursiveReverse", 0 },
+    { "printList", 0 },
+    { "removeAllItems", 0 },
+    { "enqueue", 1 },               // value
+    { "dequeue", 0 },
+    { "reverse", 0 },               // queue, via a stack (Q4)
+    { "printQueue", 0 },
+    { "push", 1 },                  // value
+    { "pop", 0 },
+    { "printStack", 0 },
+    { "insertBSTNode", 1 },         // value
+    { "removeNodeFromTree", 1 },    // value
+    { "levelOrderTraversal", 0 },
+    { "inOrderIterative", 0 },
+    { "preOrderIterative", 0 },
+    { "postOrderIterativeS1", 0 },
+    { "postOrderIterativeS2", 0 },
+    { "removeAll", 0 }
+};
+
+typedef struct _batchstate {
+    LinkedList ll;
+    Queue q;
+    Stack s;
+    BSTNode *root;
+    int quiet;              // -q: values go into checksum instead of stdout
+    unsigned long long checksum;
+    long long ops;
+} BatchState;
+
+//////////////////////////////////////////////////////////////////////////////////
+// Function Prototypes
+//////////////////////////////////////////////////////////////////////////////////
+
+ListNode *findNode(LinkedList *ll, int index);
+int insertNode(LinkedList *ll, int index, int value);
+int appendNode(LinkedList *ll, int value);
+int removeNode(LinkedList *ll, int index);
+void removeAllItems(LinkedList *ll);
+int insertSortedLL(LinkedList *ll, int item);
+void RecursiveReverse(ListNode **ptrHead);
+
+void enqueue(Queue *q, int item);
+int dequeue(Queue *q);
+int isEmptyQueue(Queue *q);
+void reverse(Queue *q);
+void push(Stack *s, int item);
+int pop(Stack *s);
+int isEmptyStack(Stack *s);
+
+void insertBSTNode(BSTNode **node, int value);
+BSTNode *removeNodeFromTree(BSTNode *root, int value);
+void levelOrderTraversal(BSTNode *root);
+void inOrderIterative(BSTNode *root);
+void preOrderIterative(BSTNode *root);
+void postOrderIterativeS1(BSTNode *root);
+void postOrderIterativeS2(BSTNode *root);
+void removeAll(BSTNode **node);
+
+static void runOp(BatchState *st, int op, const int *args);
+
+//////////////////////////////////////////////////////////////////////////////////
+// Output
+//////////////////////////////////////////////////////////////////////////////////
+
+static BatchState *outputState = NULL;
+
+static void emitValue(int value) {
+    if (outputState->quiet)
+        outputState->checksum = outputState->checksum * 31 + value;
+    else
+        printf("%d ", value);
+}
+
+static void endLine(void) {
+    if (!outputState->quiet)
+        putchar('\n');
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Linked List (Section A)
+//////////////////////////////////////////////////////////////////////////////////
+
+ListNode *findNode(LinkedList *ll, int index) {
+    ListNode *temp;
+
+    if (ll == NULL || index < 0 || index >= ll->size)
+        return NULL;
+    if (index == ll->size - 1)
+        return ll->tail;
+    temp = ll->head;
+    while (index > 0) {
+        temp = temp->next;
+        index--;
+    }
+    return temp;
+}
+
+int appendNode(LinkedList *ll, int value) {
+    ListNode *node = malloc(sizeof(ListNode));
+
+    if (node == NULL)
+        exit(0);
+    node->item = value;
+    node->next = NULL;
+    if (ll->head == NULL)
+        ll->head = node;
+    else
+        ll->tail->next = node;
+    ll->tail = node;
+    ll->size++;
+    return 0;
+}
+
+int insertNode(LinkedList *ll, int index, int value) {
+    ListNode *pre, *cur;
+
+    if (ll == NULL || index < 0 || index > ll->size)
+        return -1;
+    if (index == ll->size)
+        return appendNode(ll, value);
+
+    if (index == 0) {
+        cur = ll->head;
+        ll->head = malloc(sizeof(ListNode));
+        if (ll->head == NULL)
+            exit(0);
+        ll->head->item = value;
+        ll->head->next = cur;
+        ll->size++;
+        return 0;
+    }
+
+    pre = findNode(ll, index - 1);
+    cur = pre->next;
+    pre->next = malloc(sizeof(ListNode));
+    if (pre->next == NULL)
+        exit(0);
+    pre->next->item = value;
+    pre->next->next = cur;
+    ll->size++;
+    return 0;
+}
+
+int removeNode(LinkedList *ll, int index) {
+    ListNode *pre, *cur;
+
+    if (ll == NULL || index < 0 || index >= ll->size)
+        return -1;
+
+    if (index == 0) {
+        cur = ll->head->next;
+        free(ll->head);
+        ll->head = cur;
+        ll->size--;
+        if (ll->size == 0)
+            ll->tail = NULL;
+        return 0;
+    }
+
+    pre = findNode(ll, index - 1);
+    cur = pre->next->next;
+    if (pre->next == ll->tail)
+        ll->tail = pre;
+    free(pre->next);
+    pre->next = cur;
+    ll->size--;
+    return 0;
+}
+
+void removeAllItems(LinkedList *ll) {
+    ListNode *cur = ll->head, *tmp;
+
+    while (cur != NULL) {
+        tmp = cur->next;
+        free(cur);
+        cur = tmp;
+    }
+    ll->head = NULL;
+    ll->tail = NULL;
+    ll->size = 0;
+}
+
+// Q1: same result as Q1_A_LL.c (returns the index, -1 for a duplicate)
+int insertSortedLL(LinkedList *ll, int item) {
+    ListNode *cursor = ll->head;
+    int idx = 0;
+
+    while (cursor && cursor->item < item) {
+        cursor = cursor->next;
+        idx++;
+    }
+    if (cursor && cursor->item == item)
+        return -1;
+    if (insertNode(ll, idx, item) == -1)
+        return -1;
+    return idx;
+}
+
+// Q7: same result as Q7_A_LL.c, but iterative - a recursive reverse of a
+// million-node list would overflow the call stack
+void RecursiveReverse(ListNode **ptrHead) {
+    ListNode *prev = NULL, *cur, *next;
+
+    if (ptrHead == NULL)
+        return;
+    cur = *ptrHead;
+    while (cur != NULL) {
+        next = cur->next;
+        cur->next = prev;
+        prev = cur;
+        cur = next;
+    }
+    *ptrHead = prev;
+}
+
+static void printLinkedList(LinkedList *ll) {
+    ListNode *cur = ll->head;
+
+    if (cur == NULL && !outputState->quiet)
+        printf("Empty");
+    while (cur != NULL) {
+        emitValue(cur->item);
+        cur = cur->next;
+    }
+    endLine();
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Stack and Queue (Section C)
+//////////////////////////////////////////////////////////////////////////////////
+
+void enqueue(Queue *q, int item) {
+    appendNode(&(q->ll), item);
+}
+
+int dequeue(Queue *q) {
+    int item;
+
+    if (isEmptyQueue(q))
+        return -1;
+    item = q->ll.head->item;
+    removeNode(&(q->ll), 0);
+    return item;
+}
+
+int isEmptyQueue(Queue *q) {
+    return q->ll.size == 0;
+}
+
+// Q4: reverse the queue through a stack
+void reverse(Queue *q) {
+    Stack s;
+
+    if (q->ll.size <= 1)
+        return;
+    s.ll.head = NULL;
+    s.ll.tail = NULL;
+    s.ll.size = 0;
+    while (q->ll.size > 0)
+        push(&s, dequeue(q));
+    while (s.ll.size > 0)
+        enqueue(q, pop(&s));
+}
+
+void push(Stack *s, int item) {
+    insertNode(&(s->ll), 0, item);
+}
+
+int pop(Stack *s) {
+    int item;
+
+    if (isEmptyStack(s))
+        return -1000;   // MIN_INT in the Section C files
+    item = s->ll.head->item;
+    removeNode(&(s->ll), 0);
+    return item;
+}
+
+int isEmptyStack(Stack *s) {
+    return s->ll.size == 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Binary Search Tree (Section F)
+//////////////////////////////////////////////////////////////////////////////////
+
+static void initNodeStack(NodeStack *ns) {
+    ns->items = NULL;
+    ns->size = 0;
+    ns->capacity = 0;
+}
+
+static void pushNode(NodeStack *ns, BSTNode *node) {
+    BSTNode **items;
+
+    if (ns->size == ns->capacity) {
+        ns->capacity = ns->capacity ? ns->capacity * 2 : 64;
+        items = realloc(ns->items, sizeof(BSTNode *) * ns->capacity);
+        if (items == NULL)
+            exit(0);
+        ns->items = items;
+    }
+    ns->items[ns->size++] = node;
+}
+
+static BSTNode *popNode(NodeStack *ns) {
+    return ns->items[--ns->size];
+}
+
+// Iterative so that sorted input (a degenerate tree) cannot overflow the call stack
+void insertBSTNode(BSTNode **node, int value) {
+    while (*node != NULL) {
+        if (value < (*node)->item)
+            node = &((*node)->left);
+        else if (value > (*node)->item)
+            node = &((*node)->right);
+        else
+            return;
+    }
+    *node = malloc(sizeof(BSTNode));
+    if (*node == NULL)
+        exit(0);
+    (*node)->item = value;
+    (*node)->left = NULL;
+    (*node)->right = NULL;
+}
+
+// Q5's removeNodeFromTree, iteratively: a node with two children takes its
+// in-order successor's value and the successor is unlinked instead
+BSTNode *removeNodeFromTree(BSTNode *root, int value) {
+    BSTNode **link = &root, **succLink, *target;
+
+    while (*link != NULL && (*link)->item != value)
+        link = value < (*link)->item ? &((*link)->left) : &((*link)->right);
+    if (*link == NULL)
+        return root;
+
+    target = *link;
+    if (target->left != NULL && target->right != NULL) {
+        succLink = &(target->right);
+        while ((*succLink)->left != NULL)
+            succLink = &((*succLink)->left);
+        target->item = (*succLink)->item;
+        link = succLink;
+        target = *link;
+    }
+    *link = target->left != NULL ? target->left : target->right;
+    free(target);
+    return root;
+}
+
+void levelOrderTraversal(BSTNode *root) {
+    NodeStack queue;
+    BSTNode *node;
+    int head = 0;
+
+    if (root == NULL)
+        return;
+    initNodeStack(&queue);
+    pushNode(&queue, root);
+    while (head < queue.size) {
+        node = queue.items[head++];
+        emitValue(node->item);
+        if (node->left)
+            pushNode(&queue, node->left);
+        if (node->right)
+            pushNode(&queue, node->right);
+    }
+    free(queue.items);
+}
+
+// The Q2-Q4 solutions unlink nodes as they go; the driver must keep the tree,
+// so these are the standard non-destructive stack walks with the same output
+void inOrderIterative(BSTNode *root) {
+    NodeStack stack;
+    BSTNode *cur = root;
+
+    initNodeStack(&stack);
+    while (cur != NULL || stack.size > 0) {
+        while (cur != NULL) {
+            pushNode(&stack, cur);
+            cur = cur->left;
+        }
+        cur = popNode(&stack);
+        emitValue(cur->item);
+        cur = cur->right;
+    }
+    free(stack.items);
+}
+
+void preOrderIterative(BSTNode *root) {
+    NodeStack stack;
+    BSTNode *node;
+
+    if (root == NULL)
+        return;
+    initNodeStack(&stack);
+    pushNode(&stack, root);
+    while (stack.size > 0) {
+        node = popNode(&stack);
+        emitValue(node->item);
+        if (node->right)
+            pushNode(&stack, node->right);
+        if (node->left)
+            pushNode(&stack, node->left);
+    }
+    free(stack.items);
+}
+
+void postOrderIterativeS1(BSTNode *root) {
+    NodeStack stack;
+    BSTNode *cur = root, *lastVisited = NULL, *top;
+
+    initNodeStack(&stack);
+    while (cur != NULL || stack.size > 0) {
+        if (cur != NULL) {
+            pushNode(&stack, cur);
+            cur = cur->left;
+            continue;
+        }
+        top = stack.items[stack.size - 1];
+        if (top->right != NULL && top->right != lastVisited) {
+            cur = top->right;
+        } else {
+            emitValue(top->item);
+            lastVisited = popNode(&stack);
+        }
+    }
+    free(stack.items);
+}
+
+void postOrderIterativeS2(BSTNode *root) {
+    NodeStack s1, s2;
+    BSTNode *node;
+
+    if (root == NULL)
+        return;
+    initNodeStack(&s1);
+    initNodeStack(&s2);
+    pushNode(&s1, root);
+    while (s1.size > 0) {
+        node = popNode(&s1);
+        pushNode(&s2, node);
+        if (node->left)
+            pushNode(&s1, node->left);
+        if (node->right)
+            pushNode(&s1, node->right);
+    }
+    while (s2.size > 0)
+        emitValue(popNode(&s2)->item);
+    free(s1.items);
+    free(s2.items);
+}
+
+void removeAll(BSTNode **node) {
+    BSTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
+    }
+    *node = NULL;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Dispatch
+//////////////////////////////////////////////////////////////////////////////////
+
+static void runOp(BatchState *st, int op, const int *args) {
+    int result;
+
+    st->ops++;
+    switch (op) {
+    case OP_INSERT:
+        insertNode(&st->ll, args[0], args[1]);
+        break;
+    case OP_REMOVE:
+        removeNode(&st->ll, args[0]);
+        break;
+    case OP_INSERT_SORTED:
+        result = insertSortedLL(&st->ll, args[0]);
+        if (st->quiet)
+            st->checksum += result;
+        break;
+    case OP_REVERSE:
+        // the old head becomes the tail
+        st->ll.tail = st->ll.head;
+        RecursiveReverse(&(st->ll.head));
+        break;
+    case OP_PRINT_LIST:
+        printLinkedList(&st->ll);
+        break;
+    case OP_CLEAR_LIST:
+        removeAllItems(&st->ll);
+        break;
+    case OP_ENQUEUE:
+        enqueue(&st->q, args[0]);
+        break;
+    case OP_DEQUEUE:
+        result = dequeue(&st->q);
+        if (st->quiet)
+            st->checksum += result;
+        break;
+    case OP_REVERSE_QUEUE:
+        reverse(&st->q);
+        break;
+    case OP_PRINT_QUEUE:
+        printLinkedList(&(st->q.ll));
+        break;
+    case OP_PUSH:
+        push(&st->s, args[0]);
+        break;
+    case OP_POP:
+        result = pop(&st->s);
+        if (st->quiet)
+            st->checksum += result;
+        break;
+    case OP_PRINT_STACK:
+        printLinkedList(&(st->s.ll));
+        break;
+    case OP_BST_INSERT:
+        insertBSTNode(&st->root, args[0]);
+        break;
+    case OP_BST_REMOVE:
+        st->root = removeNodeFromTree(st->root, args[0]);
+        break;
+    case OP_LEVEL_ORDER:
+        levelOrderTraversal(st->root);
+        endLine();
+        break;
+    case OP_IN_ORDER:
+        inOrderIterative(st->root);
+        endLine();
+        break;
+    case OP_PRE_ORDER:
+        preOrderIterative(st->root);
+        endLine();
+        break;
+    case OP_POST_ORDER_S1:
+        postOrderIterativeS1(st->root);
+        endLine();
+        break;
+    case OP_POST_ORDER_S2:
+        postOrderIterativeS2(st->root);
+        endLine();
+        break;
+    case OP_CLEAR_BST:
+        removeAll(&st->root);
+        break;
+    }
+}
+
+static int lookupOp(const char *name) {
+    int op;
+
+    for (op = 0; op < OP_COUNT; op++) {
+        if (strcmp(opTable[op].name, name) == 0)
+            return op;
+    }
+    return -1;
+}
+
+// One operation per line: "<functionName> [args...]"; blank lines and '#' comments are skipped
+static int runScript(BatchState *st, FILE *in) {
+    char line[LINE_SIZE];
+    char *p, *word, *end;
+    long lineNo = 0;
+    int op, i, args[2];
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        lineNo++;
+        p = line;
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0')
+            continue;
+        word = p;
+        while (*p && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
+            p++;
+        if (*p)
+            *p++ = '\0';
+
+        op = lookupOp(word);
+        if (op == -1) {
+            fprintf(stderr, "line %ld: unknown operation '%s'\n", lineNo, word);
+            return 1;
+        }
+        for (i = 0; i < opTable[op].argc; i++) {
+            args[i] = (int)strtol(p, &end, 10);
+            if (end == p) {
+                fprintf(stderr, "line %ld: %s expects %d argument(s)\n", lineNo, word, opTable[op].argc);
+                return 1;
+            }
+            p = end;
+        }
+        runOp(st, op, args);
+    }
+    return 0;
+}
+
+// Native-endian int32 stream: an opcode (index into opTable) followed by its arguments
+static int runBinary(BatchState *st, FILE *in) {
+    int buffer[BINARY_BLOCK];
+    int args[2];
+    size_t n, pos = 0;
+    int op = -1, have = 0;
+
+    while ((n = fread(buffer, sizeof(int), BINARY_BLOCK, in)) > 0) {
+        for (pos = 0; pos < n; pos++) {
+            if (op == -1) {
+                op = buffer[pos];
+                if (op < 0 || op >= OP_COUNT) {
+                    fprintf(stderr, "record %lld: unknown opcode %d\n", st->ops + 1, op);
+                    return 1;
+                }
+                have = 0;
+            } else {
+                args[have++] = buffer[pos];
+            }
+            if (have == opTable[op].argc) {
+                runOp(st, op, args);
+                op = -1;
+            }
+        }
+    }
+    if (op != -1) {
+        fprintf(stderr, "record %lld: stream ends inside %s\n", st->ops + 1, opTable[op].name);
+        return 1;
+    }
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Main
+//////////////////////////////////////////////////////////////////////////////////
+
+static void usage(const char *prog) {
+    int op;
+
+    fprintf(stderr, "usage: %s [-b] [-q] [file]\n", prog);
+    fprintf(stderr, "  -b  read a binary int stream instead of a text script\n");
+    fprintf(stderr, "  -q  do not print traversals; report a checksum instead\n");
+    fprintf(stderr, "  file defaults to stdin\n\noperations (opcode: name args):\n");
+    for (op = 0; op < OP_COUNT; op++)
+        fprintf(stderr, "  %2d: %s (%d)\n", op, opTable[op].name, opTable[op].argc);
+}
+
+int main(int argc, char *argv[]) {
+    BatchState st;
+    FILE *in = stdin;
+    const char *path = NULL;
+    int binary = 0, result, i;
+    struct timespec t0, t1;
+    double seconds;
+
+    memset(&st, 0, sizeof(st));
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-b") == 0)
+            binary = 1;
+        else if (strcmp(argv[i], "-q") == 0)
+            st.quiet = 1;
+        else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            usage(argv[0]);
+            return 1;
+        } else
+            path = argv[i];
+    }
+
+    if (path != NULL && strcmp(path, "-") != 0) {
+        in = fopen(path, binary ? "rb" : "r");
+        if (in == NULL) {
+            perror(path);
+            return 1;
+        }
+    }
+    setvbuf(in, NULL, _IOFBF, IO_BUFFER_SIZE);
+    setvbuf(stdout, NULL, _IOFBF, IO_BUFFER_SIZE);
+    outputState = &st;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    result = binary ? runBinary(&st, in) : runScript(&st, in);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    fflush(stdout);
+
+    seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    fprintf(stderr, "%lld operations in %.3f s (%.1f ns/op)", st.ops, seconds,
+        st.ops ? seconds * 1e9 / st.ops : 0.0);
+    if (st.quiet)
+        fprintf(stderr, ", checksum %llu", st.checksum);
+    fprintf(stderr, "\n");
+
+    removeAllItems(&st.ll);
+    removeAllItems(&(st.q.ll));
+    removeAllItems(&(st.s.ll));
+    removeAll(&st.root);
+    if (in != stdin)
+        fclose(in);
+    return result;
+}
@@ -0,0 +1,891 @@
+//////////////////////////////////////////////////////////////////////////////////
+/* Microbenchmark Suite - Linked List, Stack & Queue, Binary Tree and BST
+   operations at sizes from 10 to 10^7, reported as CSV or JSON */
+//////////////////////////////////////////////////////////////////////////////////
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+
+#define DEFAULT_MIN_SIZE 10
+#define DEFAULT_MAX_SIZE 10000000
+#define TARGET_OPS 1000000      // small sizes are repeated until about this many ops
+#define PROBES 1000             // O(n) operations are sampled this many times per size
+
+//////////////////////////////////////////////////////////////////////////////////
+// Allocation Counting
+//////////////////////////////////////////////////////////////////////////////////
+
+static long long allocCount = 0;
+
+static void *countedMalloc(size_t size) {
+    allocCount++;
+    return malloc(size);
+}
+
+// Everything below allocates through countedMalloc
+#define malloc(size) countedMalloc(size)
+
+//////////////////////////////////////////////////////////////////////////////////
+// Data Structure Definitions
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _listnode {
+    int item;
+    struct _listnode *next;
+} ListNode;
+
+typedef struct _linkedlist {
+    int size;
+    ListNode *head;
+    ListNode *tail;     // only maintained by the Section C queue
+} LinkedList;
+
+typedef struct _queue {
+    LinkedList ll;
+} Queue;
+
+typedef struct _stack {
+    LinkedList ll;
+} Stack;
+
+typedef struct _btnode {
+    int item;
+    struct _btnode *left;
+    struct _btnode *right;
+} BTNode;
+
+typedef struct _bstnode {
+    int item;
+    struct _bstnode *left;
+    struct _bstnode *right;
+} BSTNode;
+
+typedef struct _queuenode {
+    BSTNode *data;
+    struct _queuenode *nextPtr;
+} QueueNode;
+
+typedef struct _stacknode {
+    BSTNode *data;
+    struct _stacknode *next;
+} StackNode;
+
+typedef struct _bststack {
+    StackNode *top;
+} BSTStack;
+
+//////////////////////////////////////////////////////////////////////////////////
+// Measurement
+//////////////////////////////////////////////////////////////////////////////////
+
+typedef struct _result {
+    long long ops;
+    long long ns;
+    long long allocs;
+} Result;
+
+static long long timerStart, allocStart;
+static long long sink = 0;      // keeps visited values alive
+static int jsonOutput = 0;
+static int rowsPrinted = 0;
+static unsigned int rngState = 12345;
+
+static long long nowNs(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void startTimer(void) {
+    allocStart = allocCount;
+    timerStart = nowNs();
+}
+
+static void stopTimer(Result *r, long long ops) {
+    r->ns += nowNs() - timerStart;
+    r->allocs += allocCount - allocStart;
+    r->ops += ops;
+}
+
+static int nextRandom(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (int)(rngState & 0x7fffffff);
+}
+
+static int repsFor(int n) {
+    return n >= TARGET_OPS ? 1 : TARGET_OPS / n;
+}
+
+static void visit(int item) {
+    sink += item;
+}
+
+static void report(const char *family, const char *operation, int n, Result *r) {
+    double nsPerOp = r->ops ? (double)r->ns / r->ops : 0.0;
+    double mops = r->ns ? r->ops * 1e3 / r->ns : 0.0;
+    double allocsPerOp = r->ops ? (double)r->allocs / r->ops : 0.0;
+
+    if (jsonOutput) {
+        printf("%s  {\"family\": \"%s\", \"operation\": \"%s\", \"n\": %d, \"ops\": %lld, "
+            "\"ns_per_op\": %.2f, \"mops_per_s\": %.3f, \"allocs_per_op\": %.3f}",
+            rowsPrinted ? ",\n" : "", family, operation, n, r->ops, nsPerOp, mops, allocsPerOp);
+    } else {
+        printf("%s,%s,%d,%lld,%.2f,%.3f,%.3f\n", family, operation, n, r->ops, nsPerOp, mops, allocsPerOp);
+    }
+    rowsPrinted++;
+    fflush(stdout);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Section A: Linked List (as in Linked_List/Q*_A_LL.c)
+//////////////////////////////////////////////////////////////////////////////////
+
+ListNode *findNode(LinkedList *ll, int index) {
+    ListNode *temp;
+
+    if (ll == NULL || index < 0 || index >= ll->size)
+        return NULL;
+    temp = ll->head;
+    if (temp == NULL || index < 0)
+        return NULL;
+    while (index > 0) {
+        temp = temp->next;
+        if (temp == NULL)
+            return NULL;
+        index--;
+    }
+    return temp;
+}
+
+int insertNode(LinkedList *ll, int index, int value) {
+    ListNode *pre, *cur;
+
+    if (ll == NULL || index < 0 || index > ll->size + 1)
+        return -1;
+    if (ll->head == NULL || index == 0) {
+        cur = ll->head;
+        ll->head = malloc(sizeof(ListNode));
+        ll->head->item = value;
+        ll->head->next = cur;
+        ll->size++;
+        return 0;
+    }
+    if ((pre = findNode(ll, index - 1)) != NULL) {
+        cur = pre->next;
+        pre->next = malloc(sizeof(ListNode));
+        pre->next->item = value;
+        pre->next->next = cur;
+        ll->size++;
+        return 0;
+    }
+    return -1;
+}
+
+int removeNode(LinkedList *ll, int index) {
+    ListNode *pre, *cur;
+
+    if (ll == NULL || index < 0 || index >= ll->size)
+        return -1;
+    if (index == 0) {
+        cur = ll->head->next;
+        free(ll->head);
+        ll->head = cur;
+        ll->size--;
+        return 0;
+    }
+    if ((pre = findNode(ll, index - 1)) != NULL) {
+        if (pre->next == NULL)
+            return -1;
+        cur = pre->next;
+        pre->next = cur->next;
+        free(cur);
+        ll->size--;
+        return 0;
+    }
+    return -1;
+}
+
+void removeAllItems(LinkedList *ll) {
+    ListNode *cur = ll->head, *tmp;
+
+    while (cur != NULL) {
+        tmp = cur->next;
+        free(cur);
+        cur = tmp;
+    }
+    ll->head = NULL;
+    ll->tail = NULL;
+    ll->size = 0;
+}
+
+static void initList(LinkedList *ll) {
+    ll->head = NULL;
+    ll->tail = NULL;
+    ll->size = 0;
+}
+
+// O(n) operations get fewer samples as n grows (about 10^8 node steps per size)
+static int probesFor(int n) {
+    int probes = n < PROBES ? n : PROBES;
+
+    if (probes > 100000000 / n)
+        probes = 100000000 / n > 0 ? 100000000 / n : 1;
+    return probes;
+}
+
+// insertNode at the head is O(1); insertNode at the tail and findNode/removeNode
+// at a random index walk the list, so they are sampled against a list of size n
+static void benchLinkedList(int n) {
+    Result insertHead = {0}, insertTail = {0}, find = {0}, removeRandom = {0}, removeHead = {0};
+    LinkedList ll, extra;
+    ListNode *last;
+    int reps = repsFor(n), probes = probesFor(n);
+    int r, i;
+
+    initList(&ll);
+    for (r = 0; r < reps; r++) {
+        startTimer();
+        for (i = 0; i < n; i++)
+            insertNode(&ll, 0, i);
+        stopTimer(&insertHead, n);
+
+        if (r == 0) {
+            startTimer();
+            for (i = 0; i < probes; i++)
+                visit(findNode(&ll, nextRandom() % ll.size)->item);
+            stopTimer(&find, probes);
+
+            startTimer();
+            for (i = 0; i < probes; i++)
+                insertNode(&ll, ll.size, i);
+            stopTimer(&insertTail, probes);
+            // cut the appended nodes off again (untimed)
+            last = findNode(&ll, n - 1);
+            initList(&extra);
+            extra.head = last->next;
+            last->next = NULL;
+            ll.size = n;
+            removeAllItems(&extra);
+
+            startTimer();
+            for (i = 0; i < probes; i++)
+                removeNode(&ll, nextRandom() % ll.size);
+            stopTimer(&removeRandom, probes);
+            for (i = 0; i < probes; i++)
+                insertNode(&ll, 0, i);
+        }
+
+        startTimer();
+        while (ll.size > 0)
+            removeNode(&ll, 0);
+        stopTimer(&removeHead, n);
+    }
+    report("LL", "insertNode(head)", n, &insertHead);
+    report("LL", "insertNode(tail)", n, &insertTail);
+    report("LL", "findNode(random)", n, &find);
+    report("LL", "removeNode(random)", n, &removeRandom);
+    report("LL", "removeNode(head)", n, &removeHead);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Section C: Stack and Queue (as in Stack_and_Queue/Q*_C_SQ.c)
+//////////////////////////////////////////////////////////////////////////////////
+
+int appendNode(LinkedList *ll, int value) {
+    ListNode *node = malloc(sizeof(ListNode));
+
+    if (node == NULL)
+        exit(0);
+    node->item = value;
+    node->next = NULL;
+    if (ll->head == NULL)
+        ll->head = node;
+    else
+        ll->tail->next = node;
+    ll->tail = node;
+    ll->size++;
+    return 0;
+}
+
+void enqueue(Queue *q, int item) {
+    appendNode(&(q->ll), item);
+}
+
+int dequeue(Queue *q) {
+    int item;
+
+    if (q->ll.head == NULL)
+        return -1;
+    item = q->ll.head->item;
+    removeNode(&(q->ll), 0);
+    if (q->ll.size == 0)
+        q->ll.tail = NULL;
+    return item;
+}
+
+void push(Stack *s, int item) {
+    insertNode(&(s->ll), 0, item);
+}
+
+int pop(Stack *s) {
+    int item;
+
+    if (s->ll.head == NULL)
+        return -1000;
+    item = s->ll.head->item;
+    removeNode(&(s->ll), 0);
+    return item;
+}
+
+static void benchStackQueue(int n) {
+    Result enq = {0}, deq = {0}, pushes = {0}, pops = {0};
+    Queue q;
+    Stack s;
+    int reps = repsFor(n);
+    int r, i;
+
+    initList(&q.ll);
+    initList(&s.ll);
+    for (r = 0; r < reps; r++) {
+        startTimer();
+        for (i = 0; i < n; i++)
+            enqueue(&q, i);
+        stopTimer(&enq, n);
+        startTimer();
+        for (i = 0; i < n; i++)
+            visit(dequeue(&q));
+        stopTimer(&deq, n);
+
+        startTimer();
+        for (i = 0; i < n; i++)
+            push(&s, i);
+        stopTimer(&pushes, n);
+        startTimer();
+        for (i = 0; i < n; i++)
+            visit(pop(&s));
+        stopTimer(&pops, n);
+    }
+    report("SQ", "enqueue", n, &enq);
+    report("SQ", "dequeue", n, &deq);
+    report("SQ", "push", n, &pushes);
+    report("SQ", "pop", n, &pops);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Section E: Binary Tree reductions (as in Binary_Tree/Q*_E_BT.c)
+//////////////////////////////////////////////////////////////////////////////////
+
+int identical(BTNode *tree1, BTNode *tree2) {
+    if (tree1 == NULL && tree2 == NULL)
+        return 1;
+    if (tree1 == NULL || tree2 == NULL || tree1->item != tree2->item)
+        return 0;
+    return identical(tree1->left, tree2->left) && identical(tree1->right, tree2->right);
+}
+
+int maxHeight(BTNode *node) {
+    int leftHeight, rightHeight;
+
+    if (node == NULL)
+        return -1;
+    leftHeight = maxHeight(node->left);
+    rightHeight = maxHeight(node->right);
+    return 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+}
+
+int countOneChildNodes(BTNode *node) {
+    int ret = 0;
+
+    if (node == NULL)
+        return 0;
+    ret += countOneChildNodes(node->left);
+    ret += countOneChildNodes(node->right);
+    if (node->left == NULL && node->right != NULL)
+        ret += 1;
+    if (node->left != NULL && node->right == NULL)
+        ret += 1;
+    return ret;
+}
+
+int sumOfOddNodes(BTNode *root) {
+    int ret = 0;
+
+    if (root == NULL)
+        return 0;
+    if (root->item % 2 == 1)
+        ret = root->item;
+    ret += sumOfOddNodes(root->left);
+    ret += sumOfOddNodes(root->right);
+    return ret;
+}
+
+void mirrorTree(BTNode *node) {
+    BTNode *temp;
+
+    if (node == NULL)
+        return;
+    temp = node->left;
+    node->left = node->right;
+    node->right = temp;
+    mirrorTree(node->left);
+    mirrorTree(node->right);
+}
+
+void printSmallerValues(BTNode *node, int m) {
+    if (node == NULL)
+        return;
+    if (node->item < m)
+        visit(node->item);
+    printSmallerValues(node->left, m);
+    printSmallerValues(node->right, m);
+}
+
+int smallestValue(BTNode *node) {
+    int ret, leftRet, rightRet;
+
+    if (node == NULL)
+        return INT_MAX;
+    ret = node->item;
+    leftRet = smallestValue(node->left);
+    rightRet = smallestValue(node->right);
+    if (leftRet < ret)
+        ret = leftRet;
+    if (rightRet < ret)
+        ret = rightRet;
+    return ret;
+}
+
+int hasGreatGrandchild(BTNode *node) {
+    int ret, leftRet, rightRet;
+
+    if (node == NULL)
+        return 0;
+    leftRet = hasGreatGrandchild(node->left);
+    rightRet = hasGreatGrandchild(node->right);
+    ret = leftRet > rightRet ? leftRet : rightRet;
+    if (ret > 2)
+        visit(node->item);
+    return 1 + ret;
+}
+
+// Random tree shape: keys dropped in BST order, so the depth stays O(log n)
+static BTNode *buildRandomBT(int n) {
+    BTNode *root = NULL, **link, *node;
+    int i, key;
+
+    for (i = 0; i < n; i++) {
+        key = nextRandom() % (4 * n);
+        link = &root;
+        while (*link != NULL)
+            link = key < (*link)->item ? &((*link)->left) : &((*link)->right);
+        node = malloc(sizeof(BTNode));
+        if (node == NULL)
+            exit(0);
+        node->item = key;
+        node->left = NULL;
+        node->right = NULL;
+        *link = node;
+    }
+    return root;
+}
+
+static BTNode *copyBT(BTNode *node) {
+    BTNode *copy;
+
+    if (node == NULL)
+        return NULL;
+    copy = malloc(sizeof(BTNode));
+    if (copy == NULL)
+        exit(0);
+    copy->item = node->item;
+    copy->left = copyBT(node->left);
+    copy->right = copyBT(node->right);
+    return copy;
+}
+
+static void removeBT(BTNode *node) {
+    if (node == NULL)
+        return;
+    removeBT(node->left);
+    removeBT(node->right);
+    free(node);
+}
+
+static void benchBinaryTree(int n) {
+    Result same = {0}, height = {0}, oneChild = {0}, oddSum = {0}, mirror = {0};
+    Result smaller = {0}, smallest = {0}, greatGrand = {0};
+    BTNode *tree = buildRandomBT(n);
+    BTNode *twin = copyBT(tree);
+    int reps = repsFor(n);
+    int r;
+
+    for (r = 0; r < reps; r++) {
+        startTimer();
+        visit(identical(tree, twin));
+        stopTimer(&same, n);
+        startTimer();
+        visit(maxHeight(tree));
+        stopTimer(&height, n);
+        startTimer();
+        visit(countOneChildNodes(tree));
+        stopTimer(&oneChild, n);
+        startTimer();
+        visit(sumOfOddNodes(tree));
+        stopTimer(&oddSum, n);
+        startTimer();
+        mirrorTree(tree);
+        stopTimer(&mirror, n);
+        startTimer();
+        printSmallerValues(tree, 2 * n);
+        stopTimer(&smaller, n);
+        startTimer();
+        visit(smallestValue(tree));
+        stopTimer(&smallest, n);
+        startTimer();
+        visit(hasGreatGrandchild(tree));
+        stopTimer(&greatGrand, n);
+    }
+    report("BT", "identical", n, &same);
+    report("BT", "maxHeight", n, &height);
+    report("BT", "countOneChildNodes", n, &oneChild);
+    report("BT", "sumOfOddNodes", n, &oddSum);
+    report("BT", "mirrorTree", n, &mirror);
+    report("BT", "printSmallerValues", n, &smaller);
+    report("BT", "smallestValue", n, &smallest);
+    report("BT", "hasGreatGrandchild", n, &greatGrand);
+    removeBT(tree);
+    removeBT(twin);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Section F: Binary Search Tree (as in Binary_Search_Tree/Q*_F_BST.c)
+//////////////////////////////////////////////////////////////////////////////////
+
+void insertBSTNode(BSTNode **node, int value) {
+    if (*node == NULL) {
+        *node = malloc(sizeof(BSTNode));
+        if (*node != NULL) {
+            (*node)->item = value;
+            (*node)->left = NULL;
+            (*node)->right = NULL;
+        }
+    } else {
+        if (value < (*node)->item)
+            insertBSTNode(&((*node)->left), value);
+        else if (value > (*node)->item)
+            insertBSTNode(&((*node)->right), value);
+        else
+            return;
+    }
+}
+
+void removeAll(BSTNode **node) {
+    BSTNode *cur = *node, *next;
+
+    while (cur != NULL) {
+        if (cur->left == NULL) {
+            next = cur->right;
+            free(cur);
+        }
+        else {
+            next = cur->left;
+            cur->left = next->right;
+            next->right = cur;
+        }
+        cur = next;
+    }
+    *node = NULL;
+}
+
+void enqueueNode(QueueNode **headPtr, QueueNode **tailPtr, BSTNode *node) {
+    QueueNode *newPtr = malloc(sizeof(QueueNode));
+
+    if (newPtr != NULL) {
+        newPtr->data = node;
+        newPtr->nextPtr = NULL;
+        if (*headPtr == NULL)
+            *headPtr = newPtr;
+        else
+            (*tailPtr)->nextPtr = newPtr;
+        *tailPtr = newPtr;
+    }
+}
+
+BSTNode *dequeueNode(QueueNode **headPtr, QueueNode **tailPtr) {
+    BSTNode *node = (*headPtr)->data;
+    QueueNode *tempPtr = *headPtr;
+
+    *headPtr = (*headPtr)->nextPtr;
+    if (*headPtr == NULL)
+        *tailPtr = NULL;
+    free(tempPtr);
+    return node;
+}
+
+void pushNode(BSTStack *stack, BSTNode *node) {
+    StackNode *temp = malloc(sizeof(StackNode));
+
+    if (temp == NULL)
+        return;
+    temp->data = node;
+    temp->next = stack->top;
+    stack->top = temp;
+}
+
+BSTNode *popNode(BSTStack *s) {
+    StackNode *t = s->top;
+    BSTNode *ptr = NULL;
+
+    if (t != NULL) {
+        ptr = t->data;
+        s->top = t->next;
+        free(t);
+    }
+    return ptr;
+}
+
+void levelOrderTraversal(BSTNode *root) {
+    QueueNode *head = NULL, *tail = NULL;
+    BSTNode *node;
+
+    if (root == NULL)
+        return;
+    enqueueNode(&head, &tail, root);
+    while (head != NULL) {
+        node = dequeueNode(&head, &tail);
+        visit(node->item);
+        if (node->left)
+            enqueueNode(&head, &tail, node->left);
+        if (node->right)
+            enqueueNode(&head, &tail, node->right);
+    }
+}
+
+// Q2-Q4 unlink (and free) every node except the root as they print it,
+// so each timed run gets a fresh copy of the tree
+void inOrderIterative(BSTNode *root) {
+    BSTStack stack = { NULL };
+    BSTNode *node;
+
+    if (root == NULL)
+        return;
+    pushNode(&stack, root);
+    while (stack.top != NULL) {
+        node = popNode(&stack);
+        if (!node->left && !node->right) {
+            visit(node->item);
+            if (node != root)
+                free(node);
+            continue;
+        }
+        if (node->right) {
+            pushNode(&stack, node->right);
+            node->right = NULL;
+        }
+        pushNode(&stack, node);
+        if (node->left) {
+            pushNode(&stack, node->left);
+            node->left = NULL;
+        }
+    }
+}
+
+void preOrderIterative(BSTNode *root) {
+    BSTStack stack = { NULL };
+    BSTNode *node;
+
+    if (root == NULL)
+        return;
+    pushNode(&stack, root);
+    while (stack.top != NULL) {
+        node = popNode(&stack);
+        if (!node->left && !node->right) {
+            visit(node->item);
+            if (node != root)
+                free(node);
+            continue;
+        }
+        if (node->right) {
+            pushNode(&stack, node->right);
+            node->right = NULL;
+        }
+        if (node->left) {
+            pushNode(&stack, node->left);
+            node->left = NULL;
+        }
+        pushNode(&stack, node);
+    }
+}
+
+void postOrderIterativeS1(BSTNode *root) {
+    BSTStack stack = { NULL };
+    BSTNode *node;
+
+    if (root == NULL)
+        return;
+    pushNode(&stack, root);
+    while (stack.top != NULL) {
+        node = popNode(&stack);
+        if (!node->left && !node->right) {
+            visit(node->item);
+            if (node != root)
+                free(node);
+            continue;
+        }
+        pushNode(&stack, node);
+        if (node->right) {
+            pushNode(&stack, node->right);
+            node->right = NULL;
+        }
+        if (node->left) {
+            pushNode(&stack, node->left);
+            node->left = NULL;
+        }
+    }
+}
+
+void postOrderIterativeS2(BSTNode *root) {
+    BSTStack s1 = { NULL }, s2 = { NULL };
+    BSTNode *node;
+
+    if (root == NULL)
+        return;
+    pushNode(&s1, root);
+    while (s1.top != NULL) {
+        node = popNode(&s1);
+        pushNode(&s2, node);
+        if (node->left)
+            pushNode(&s1, node->left);
+        if (node->right)
+            pushNode(&s1, node->right);
+    }
+    while (s2.top != NULL)
+        visit(popNode(&s2)->item);
+}
+
+static BSTNode *copyBST(BSTNode *node) {
+    BSTNode *copy;
+
+    if (node == NULL)
+        return NULL;
+    copy = malloc(sizeof(BSTNode));
+    if (copy == NULL)
+        exit(0);
+    copy->item = node->item;
+    copy->left = copyBST(node->left);
+    copy->right = copyBST(node->right);
+    return copy;
+}
+
+static int countBST(BSTNode *node) {
+    if (node == NULL)
+        return 0;
+    return 1 + countBST(node->left) + countBST(node->right);
+}
+
+static void benchBinarySearchTree(int n) {
+    static const char *names[] = {
+        "levelOrderTraversal", "inOrderIterative", "preOrderIterative",
+        "postOrderIterativeS1", "postOrderIterativeS2"
+    };
+    static void (*const traversals[])(BSTNode *) = {
+        levelOrderTraversal, inOrderIterative, preOrderIterative,
+        postOrderIterativeS1, postOrderIterativeS2
+    };
+    Result insert = {0}, walk[5];
+    BSTNode *root = NULL, *work;
+    int reps = repsFor(n);
+    int r, i, t, size;
+
+    // insertBSTNode ignores duplicates, so the tree may end up slightly smaller than n
+    for (r = 0; r < reps; r++) {
+        removeAll(&root);
+        startTimer();
+        for (i = 0; i < n; i++)
+            insertBSTNode(&root, nextRandom() % (4 * n));
+        stopTimer(&insert, n);
+    }
+    size = countBST(root);
+
+    memset(walk, 0, sizeof(walk));
+    for (t = 0; t < 5; t++) {
+        for (r = 0; r < reps; r++) {
+            work = t == 0 || t == 4 ? root : copyBST(root);
+            startTimer();
+            traversals[t](work);
+            stopTimer(&walk[t], size);
+            if (work != root)
+                removeAll(&work);   // only the root is left
+        }
+    }
+
+    report("BST", "insertBSTNode", n, &insert);
+    for (t = 0; t < 5; t++)
+        report("BST", names[t], n, &walk[t]);
+    removeAll(&root);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+// Main
+//////////////////////////////////////////////////////////////////////////////////
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [--json] [--min N] [--max N] [--only LL|SQ|BT|BST]\n", prog);
+    fprintf(stderr, "  sizes run as powers of ten from --min (default %d) to --max (default %d)\n",
+        DEFAULT_MIN_SIZE, DEFAULT_MAX_SIZE);
+}
+
+int main(int argc, char *argv[]) {
+    const char *only = NULL;
+    int minSize = DEFAULT_MIN_SIZE, maxSize = DEFAULT_MAX_SIZE;
+    int i;
+    long long n;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--json") == 0)
+            jsonOutput = 1;
+        else if (strcmp(argv[i], "--min") == 0 && i + 1 < argc)
+            minSize = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max") == 0 && i + 1 < argc)
+            maxSize = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc)
+            only = argv[++i];
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (minSize < 1 || maxSize < minSize) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (jsonOutput)
+        printf("[\n");
+    else
+        printf("family,operation,n,ops,ns_per_op,mops_per_s,allocs_per_op\n");
+
+    for (n = minSize; n <= maxSize; n *= 10) {
+        if (only == NULL || strcmp(only, "LL") == 0)
+            benchLinkedList((int)n);
+        if (only == NULL || strcmp(only, "SQ") == 0)
+            benchStackQueue((int)n);
+        if (only == NULL || strcmp(only, "BT") == 0)
+            benchBinaryTree((int)n);
+        if (only == NULL || strcmp(only, "BST") == 0)
+            benchBinarySearchTree((int)n);
+    }
+
+    if (jsonOutput)
+        printf("\n]\n");
+    fprintf(stderr, "checksum %lld\n", sink);
+    return 0;
+}
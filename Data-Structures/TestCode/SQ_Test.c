@@ -183,6 +183,7 @@ typedef struct _listnode {
 typedef struct _linkedlist {
     int size;
     ListNode *head;
+    ListNode *tail;
 } LinkedList;
 
 typedef struct _stack {
@@ -199,6 +200,7 @@ typedef struct _queue {
 
 void initList(LinkedList *ll) {
     ll->head = NULL;
+    ll->tail = NULL;
     ll->size = 0;
 }
 
@@ -222,6 +224,7 @@ void removeAllItems(LinkedList *ll) {
         cur = tmp;
     }
     ll->head = NULL;
+    ll->tail = NULL;
     ll->size = 0;
 }
 
@@ -241,12 +244,32 @@ ListNode *findNode(LinkedList *ll, int index) {
     return temp;
 }
 
+int appendNode(LinkedList *ll, int value) {
+    ListNode *newNode;
+    if (ll == NULL)
+        return -1;
+    
+    newNode = malloc(sizeof(ListNode));
+    newNode->item = value;
+    newNode->next = NULL;
+    if (ll->head == NULL)
+        ll->head = newNode;
+    else
+        ll->tail->next = newNode;
+    ll->tail = newNode;
+    ll->size++;
+    return 0;
+}
+
 int insertNode(LinkedList *ll, int index, int value) {
     ListNode *pre, *cur;
     if (ll == NULL || index < 0 || index > ll->size)
         return -1;
     
-    if (ll->head == NULL || index == 0) {
+    if (index == ll->size)
+        return appendNode(ll, value);
+    
+    if (index == 0) {
         cur = ll->head;
         ll->head = malloc(sizeof(ListNode));
         ll->head->item = value;
@@ -275,6 +298,8 @@ int removeNode(LinkedList *ll, int index) {
         cur = ll->head->next;
         free(ll->head);
         ll->head = cur;
+        if (cur == NULL)
+            ll->tail = NULL;
         ll->size--;
         return 0;
     }
@@ -284,6 +309,8 @@ int removeNode(LinkedList *ll, int index) {
             return -1;
         cur = pre->next;
         pre->next = cur->next;
+        if (cur == ll->tail)
+            ll->tail = pre;
         free(cur);
         ll->size--;
         return 0;
@@ -332,7 +359,7 @@ void removeAllItemsFromStack(Stack *s) {
 //////////////////////////////////////////////////////////////////////////////////
 
 void enqueue(Queue *q, int item) {
-    insertNode(&(q->ll), q->ll.size, item);
+    appendNode(&(q->ll), item);
 }
 
 int dequeue(Queue *q) {
@@ -602,6 +629,33 @@ void test_balanced() {
     TEST_ASSERT_INT_EQ(balanced("{[(])}"), 1, "Test 8: {[(])} is NOT balanced");
 }
 
+void test_queueTailTracking() {
+    printf("\n=== Testing Queue tail tracking ===\n");
+    Queue q;
+    
+    // Test 1
+    initList(&q.ll);
+    for (int i = 1; i <= 5; i++) enqueue(&q, i);
+    TEST_ASSERT_INT_EQ(q.ll.tail->item, 5, "Test 1: tail follows enqueue");
+    
+    // Test 2
+    dequeue(&q);
+    dequeue(&q);
+    enqueue(&q, 6);
+    int expected2[] = {3, 4, 5, 6};
+    TEST_ASSERT_LL_EQ(&q.ll, expected2, 4, "Test 2: {3, 4, 5, 6} after dequeue/enqueue mix");
+    
+    // Test 3
+    removeNode(&q.ll, q.ll.size - 1);
+    TEST_ASSERT_INT_EQ(q.ll.tail->item, 5, "Test 3: tail moves back when last node removed");
+    
+    // Test 4
+    removeAllItemsFromQueue(&q);
+    enqueue(&q, 7);
+    TEST_ASSERT_INT_EQ((q.ll.head == q.ll.tail && q.ll.tail->item == 7), 1, "Test 4: {7} head == tail after draining");
+    removeAllItemsFromQueue(&q);
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // Test Summary
 //////////////////////////////////////////////////////////////////////////////////
@@ -653,6 +707,7 @@ int main() {
     RUN_SAFE_TEST(test_recursiveReverse);
     RUN_SAFE_TEST(test_removeUntil);
     RUN_SAFE_TEST(test_balanced);
+    RUN_SAFE_TEST(test_queueTailTracking);
     
     print_test_summary();
     